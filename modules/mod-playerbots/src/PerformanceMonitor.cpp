@@ -5,299 +5,577 @@
 
 #include "PerformanceMonitor.h"
 
+#include <fstream>
+#include <thread>
+
 #include "Playerbots.h"
 
+struct PerformanceRow
+{
+    std::string name;
+    PerformanceSummary summary;
+};
+
+static std::string GetMetricName(PerformanceMetric metric)
+{
+    switch (metric)
+    {
+        case PERF_MON_TRIGGER:
+            return "Trigger";
+        case PERF_MON_VALUE:
+            return "Value";
+        case PERF_MON_ACTION:
+            return "Action";
+        case PERF_MON_RNDBOT:
+            return "RndBot";
+        case PERF_MON_TOTAL:
+            return "Total";
+        case PERF_MON_STRATEGY:
+            return "Strategy";
+        default:
+            return "?";
+    }
+}
+
+static uint32 GetHistogramBucket(uint64 elapsed)
+{
+    uint32 bucket = 0;
+    while (elapsed > 1 && bucket < PERF_MON_HISTOGRAM_BUCKETS - 1)
+    {
+        elapsed >>= 1;
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+void PerformanceSummary::Add(PerformanceSummary const& other)
+{
+    if (!other.count)
+        return;
+
+    if (other.minTime && (!minTime || minTime > other.minTime))
+        minTime = other.minTime;
+
+    if (maxTime < other.maxTime)
+        maxTime = other.maxTime;
+
+    totalTime += other.totalTime;
+    selfTime += other.selfTime;
+    count += other.count;
+
+    for (uint32 i = 0; i < PERF_MON_HISTOGRAM_BUCKETS; ++i)
+        histogram[i] += other.histogram[i];
+}
+
+float PerformanceSummary::Percentile(float fraction) const
+{
+    if (!count)
+        return 0.0f;
+
+    uint64 wanted = std::max<uint64>(1, uint64(count * fraction));
+    uint64 seen = 0;
+    for (uint32 i = 0; i < PERF_MON_HISTOGRAM_BUCKETS - 1; ++i)
+    {
+        seen += histogram[i];
+        if (seen >= wanted)
+            return std::min<uint64>(uint64(2) << i, maxTime) / 1000.0f;
+    }
+
+    return maxTime / 1000.0f;
+}
+
+uint32 PerformanceMonitor::RegisterName(std::string const& name)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto i = nameIds.find(name);
+    if (i != nameIds.end())
+        return i->second;
+
+    uint32 id = names.size();
+    names.push_back(name);
+    nameIds[name] = id;
+    return id;
+}
+
 PerformanceMonitorOperation* PerformanceMonitor::start(PerformanceMetric metric, std::string const name,
                                                        PerformanceStack* stack)
 {
     if (!sPlayerbotAIConfig->perfMonEnabled)
         return nullptr;
 
-    std::string stackName = name;
+    return Begin(metric, &name, 0, stack, false);
+}
+
+PerformanceMonitorOperation* PerformanceMonitor::start(PerformanceMetric metric, uint32 nameId,
+                                                       PerformanceStack* stack)
+{
+    if (!sPlayerbotAIConfig->perfMonEnabled)
+        return nullptr;
 
-    if (stack)
+    return Begin(metric, nullptr, nameId, stack, false);
+}
+
+PerformanceMonitorOperation* PerformanceMonitor::enter(PerformanceMetric metric, uint32 nameId, PerformanceStack* stack)
+{
+    if (!sPlayerbotAIConfig->perfMonEnabled || !stack)
+        return nullptr;
+
+    return Begin(metric, nullptr, nameId, stack, true);
+}
+
+PerformanceMonitorOperation* PerformanceMonitor::Begin(PerformanceMetric metric, std::string const* name,
+                                                       uint32 nameId, PerformanceStack* stack, bool context)
+{
+    PerformanceThreadData* threadData = GetThreadData();
+
+    PerformanceMonitorOperation* op;
+    if (threadData->freeOperations.empty())
+        op = new PerformanceMonitorOperation();
+    else
+    {
+        op = threadData->freeOperations.back();
+        threadData->freeOperations.pop_back();
+    }
+
+    PerformanceMonitorOperation* parent = stack && !stack->empty() ? stack->back() : nullptr;
+
+    // whole call trees are sampled together so self times of sampled operations never hide unsampled children
+    if (parent)
+        op->weight = parent->weight;
+    else
+    {
+        uint32 rate = sPlayerbotAIConfig->perfMonSampleRate;
+        threadData->sampleSeed = threadData->sampleSeed * 1664525 + 1013904223;
+        op->weight = (threadData->sampleSeed >> 8) % rate ? 0 : rate;
+    }
+
+    // names are only resolved for sampled trees, skipped operations cost a pooled object and a stack slot
+    op->node = 0;
+    if (op->weight)
     {
-        if (!stack->empty())
+        if (name)
         {
-            std::ostringstream out;
-            out << stackName << " [";
+            auto i = threadData->nameIds.find(*name);
+            nameId = i != threadData->nameIds.end() ? i->second : (threadData->nameIds[*name] = RegisterName(*name));
+        }
+
+        op->node = GetNode(threadData, parent ? parent->node : 0, metric, nameId);
+    }
 
-            for (std::vector<std::string>::reverse_iterator i = stack->rbegin(); i != stack->rend(); ++i)
-                out << *i << (std::next(i) == stack->rend() ? "" : "|");
+    op->context = context;
+    op->stack = stack;
+    op->childTime = 0;
 
-            out << "]";
+    if (stack)
+        stack->push_back(op);
+
+    if (op->weight && !context)
+        op->started = std::chrono::steady_clock::now();
+
+    return op;
+}
+
+void PerformanceMonitorOperation::finish()
+{
+    uint64 elapsed = 0;
+    if (weight && !context)
+        elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started)
+                      .count();
+
+    if (stack)
+    {
+        if (!stack->empty() && stack->back() == this)
+            stack->pop_back();
+        else
+            stack->erase(std::remove(stack->begin(), stack->end(), this), stack->end());
+
+        if (elapsed && !stack->empty())
+            stack->back()->childTime += elapsed;
+    }
+
+    if (weight && !context && node)
+        sPerformanceMonitor->Record(this, elapsed);
+
+    sPerformanceMonitor->GetThreadData()->freeOperations.push_back(this);
+}
+
+void PerformanceMonitor::Record(PerformanceMonitorOperation* op, uint64 elapsed)
+{
+    PerformanceThreadData* threadData = GetThreadData();
+
+    uint32 currentGeneration = generation.load(std::memory_order_relaxed);
+    if (threadData->generation.load(std::memory_order_relaxed) != currentGeneration)
+    {
+        for (std::atomic<PerformanceData*>& chunk : threadData->chunks)
+        {
+            PerformanceData* chunkData = chunk.load(std::memory_order_relaxed);
+            if (!chunkData)
+                continue;
 
-            stackName = out.str().c_str();
+            for (uint32 i = 0; i < PERF_MON_CHUNK_SIZE; ++i)
+            {
+                PerformanceData& pd = chunkData[i];
+                pd.minTime.store(0, std::memory_order_relaxed);
+                pd.maxTime.store(0, std::memory_order_relaxed);
+                pd.totalTime.store(0, std::memory_order_relaxed);
+                pd.selfTime.store(0, std::memory_order_relaxed);
+                pd.count.store(0, std::memory_order_relaxed);
+                for (std::atomic<uint64>& bucket : pd.histogram)
+                    bucket.store(0, std::memory_order_relaxed);
+            }
         }
 
-        stack->push_back(name);
+        threadData->generation.store(currentGeneration, std::memory_order_release);
     }
 
-    std::lock_guard<std::mutex> guard(lock);
-    PerformanceData* pd = data[metric][stackName];
-    if (!pd)
+    // single writer per thread, plain load and store are enough and keep the hot path free of locked instructions
+    PerformanceData* pd = GetData(threadData, op->node);
+    uint64 selfTime = elapsed > op->childTime ? elapsed - op->childTime : 0;
+
+    if (elapsed)
     {
-        pd = new PerformanceData();
-        pd->minTime = 0;
-        pd->maxTime = 0;
-        pd->totalTime = 0;
-        pd->count = 0;
-        data[metric][stackName] = pd;
+        uint64 minTime = pd->minTime.load(std::memory_order_relaxed);
+        if (!minTime || minTime > elapsed)
+            pd->minTime.store(elapsed, std::memory_order_relaxed);
+
+        if (pd->maxTime.load(std::memory_order_relaxed) < elapsed)
+            pd->maxTime.store(elapsed, std::memory_order_relaxed);
     }
 
-    return new PerformanceMonitorOperation(pd, name, stack);
+    pd->totalTime.store(pd->totalTime.load(std::memory_order_relaxed) + elapsed * op->weight,
+                        std::memory_order_relaxed);
+    pd->selfTime.store(pd->selfTime.load(std::memory_order_relaxed) + selfTime * op->weight,
+                       std::memory_order_relaxed);
+    pd->count.store(pd->count.load(std::memory_order_relaxed) + op->weight, std::memory_order_relaxed);
+
+    std::atomic<uint64>& bucket = pd->histogram[GetHistogramBucket(elapsed)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + op->weight, std::memory_order_relaxed);
 }
 
-void PerformanceMonitor::PrintStats(bool perTick, bool fullStack)
+PerformanceThreadData* PerformanceMonitor::GetThreadData()
 {
-    if (data.empty())
-        return;
+    // never freed, pool threads live as long as the world and their numbers stay readable after they exit
+    thread_local PerformanceThreadData* threadData = nullptr;
+    if (!threadData)
+    {
+        threadData = new PerformanceThreadData();
+        threadData->sampleSeed = std::hash<std::thread::id>()(std::this_thread::get_id());
 
-    if (!perTick)
+        std::lock_guard<std::mutex> guard(lock);
+        threadData->generation = generation.load();
+        threads.push_back(threadData);
+    }
+
+    return threadData;
+}
+
+PerformanceData* PerformanceMonitor::GetData(PerformanceThreadData* threadData, uint32 node)
+{
+    std::atomic<PerformanceData*>& chunk = threadData->chunks[node / PERF_MON_CHUNK_SIZE];
+    PerformanceData* chunkData = chunk.load(std::memory_order_relaxed);
+    if (!chunkData)
     {
-        float updateAITotalTime = 0;
-        for (auto& map : data[PERF_MON_TOTAL])
-            if (map.first.find("PlayerbotAI::UpdateAIInternal") != std::string::npos)
-                updateAITotalTime += map.second->totalTime;
+        chunkData = new PerformanceData[PERF_MON_CHUNK_SIZE];
+        chunk.store(chunkData, std::memory_order_release);
+    }
 
-        LOG_INFO(
-            "playerbots",
-            "--------------------------------------[TOTAL BOT]------------------------------------------------------");
-        LOG_INFO("playerbots",
-                 "percentage     time  |     min ..     max (      avg  of      count) - type      : name");
-        LOG_INFO(
-            "playerbots",
-            "-------------------------------------------------------------------------------------------------------");
+    return &chunkData[node % PERF_MON_CHUNK_SIZE];
+}
+
+uint32 PerformanceMonitor::GetNode(PerformanceThreadData* threadData, uint32 parent, PerformanceMetric metric,
+                                   uint32 nameId)
+{
+    uint64 key = (uint64(parent) << 32) | (uint64(nameId) << 3) | uint64(metric);
+    auto i = threadData->nodeIds.find(key);
+    if (i != threadData->nodeIds.end())
+        return i->second;
+
+    std::lock_guard<std::mutex> guard(lock);
+    uint32 node = 0;
+    auto j = nodeIds.find(std::make_tuple(parent, nameId, uint32(metric)));
+    if (j != nodeIds.end())
+        node = j->second;
+    else if (nodes.size() < PERF_MON_CHUNK_SIZE * PERF_MON_MAX_CHUNKS)
+    {
+        node = nodes.size();
+        nodes.push_back({parent, nameId, metric});
+        nodeIds[std::make_tuple(parent, nameId, uint32(metric))] = node;
+    }
+
+    threadData->nodeIds[key] = node;
+    return node;
+}
+
+void PerformanceMonitor::Collect(std::vector<PerformanceSummary>& totals)
+{
+    std::vector<PerformanceThreadData*> threadList;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        threadList = threads;
+        totals.assign(nodes.size(), PerformanceSummary());
+    }
+
+    uint32 currentGeneration = generation.load();
+    for (PerformanceThreadData* threadData : threadList)
+    {
+        if (threadData->generation.load(std::memory_order_acquire) != currentGeneration)
+            continue;
 
-        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-             i != data.end(); ++i)
+        for (uint32 i = 0; i < PERF_MON_MAX_CHUNKS; ++i)
         {
-            std::map<std::string, PerformanceData*> pdMap = i->second;
+            PerformanceData* chunkData = threadData->chunks[i].load(std::memory_order_acquire);
+            if (!chunkData)
+                continue;
 
-            std::string key;
-            switch (i->first)
+            for (uint32 j = 0; j < PERF_MON_CHUNK_SIZE; ++j)
             {
-                case PERF_MON_TRIGGER:
-                    key = "Trigger";
-                    break;
-                case PERF_MON_VALUE:
-                    key = "Value";
-                    break;
-                case PERF_MON_ACTION:
-                    key = "Action";
-                    break;
-                case PERF_MON_RNDBOT:
-                    key = "RndBot";
-                    break;
-                case PERF_MON_TOTAL:
-                    key = "Total";
-                    break;
-                default:
-                    key = "?";
+                uint32 node = i * PERF_MON_CHUNK_SIZE + j;
+                if (node >= totals.size())
                     break;
+
+                PerformanceData& pd = chunkData[j];
+                PerformanceSummary summary;
+                summary.minTime = pd.minTime.load(std::memory_order_relaxed);
+                summary.maxTime = pd.maxTime.load(std::memory_order_relaxed);
+                summary.totalTime = pd.totalTime.load(std::memory_order_relaxed);
+                summary.selfTime = pd.selfTime.load(std::memory_order_relaxed);
+                summary.count = pd.count.load(std::memory_order_relaxed);
+                for (uint32 k = 0; k < PERF_MON_HISTOGRAM_BUCKETS; ++k)
+                    summary.histogram[k] = pd.histogram[k].load(std::memory_order_relaxed);
+
+                totals[node].Add(summary);
             }
+        }
+    }
+}
 
-            std::vector<std::string> names;
+std::string PerformanceMonitor::GetPath(uint32 node, char separator, bool reverse)
+{
+    std::lock_guard<std::mutex> guard(lock);
 
-            for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
-            {
-                if (key == "Total" && j->first.find("PlayerbotAI::UpdateAIInternal") == std::string::npos)
-                    continue;
+    std::vector<std::string> path;
+    for (; node; node = nodes[node].parent)
+    {
+        std::string name = names[nodes[node].nameId];
+        if (separator == ';')
+            std::replace(name.begin(), name.end(), ';', ':');
 
-                names.push_back(j->first);
-            }
+        path.push_back(name);
+    }
 
-            std::sort(names.begin(), names.end(),
-                      [pdMap](std::string const i, std::string const j)
-                      { return pdMap.at(i)->totalTime < pdMap.at(j)->totalTime; });
+    if (!reverse)
+        std::reverse(path.begin(), path.end());
 
-            uint64 typeTotalTime = 0;
-            uint64 typeMinTime = 0xffffffffu;
-            uint64 typeMaxTime = 0;
-            uint32 typeCount = 0;
-            for (auto& name : names)
-            {
-                PerformanceData* pd = pdMap[name];
-                typeTotalTime += pd->totalTime;
-                typeCount += pd->count;
-                if (typeMinTime > pd->minTime)
-                    typeMinTime = pd->minTime;
-                if (typeMaxTime < pd->maxTime)
-                    typeMaxTime = pd->maxTime;
-                float perc = (float)pd->totalTime / updateAITotalTime * 100.0f;
-                float time = (float)pd->totalTime / 1000000.0f;
-                float minTime = (float)pd->minTime / 1000.0f;
-                float maxTime = (float)pd->maxTime / 1000.0f;
-                float avg = (float)pd->totalTime / (float)pd->count / 1000.0f;
-                std::string disName = name;
-                if (!fullStack && disName.find("|") != std::string::npos)
-                    disName = disName.substr(0, disName.find("|")) + "]";
-
-                if (perc >= 0.1f || avg >= 0.25f || pd->maxTime > 1000)
-                {
-                    LOG_INFO("playerbots",
-                             "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", perc, time,
-                             minTime, maxTime, avg, pd->count, key.c_str(), disName.c_str());
-                }
-            }
-            float tPerc = (float)typeTotalTime / (float)updateAITotalTime * 100.0f;
-            float tTime = (float)typeTotalTime / 1000000.0f;
-            float tMinTime = (float)typeMinTime / 1000.0f;
-            float tMaxTime = (float)typeMaxTime / 1000.0f;
-            float tAvg = (float)typeTotalTime / (float)typeCount / 1000.0f;
-            LOG_INFO("playerbots", "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) - {:6}    : {}", tPerc,
-                     tTime, tMinTime, tMaxTime, tAvg, typeCount, key.c_str(), "Total");
-            LOG_INFO("playerbots", " ");
+    std::ostringstream out;
+    for (std::vector<std::string>::iterator i = path.begin(); i != path.end(); ++i)
+        out << (i == path.begin() ? "" : std::string(1, separator)) << *i;
+
+    return out.str();
+}
+
+void PerformanceMonitor::PrintStats(bool perTick, bool fullStack)
+{
+    if (uint64 deferred = scheduledBotsDeferred.load())
+    {
+        uint64 updated = scheduledBotsUpdated.load();
+        LOG_INFO("playerbots", "Scheduler: {} bot updates, {} deferred ({:.1f}%)", updated, deferred,
+                 deferred * 100.0f / (updated + deferred));
+    }
+
+    std::vector<PerformanceSummary> totals;
+    Collect(totals);
+
+    std::vector<PerformanceNode> nodeList;
+    std::vector<std::string> nameList;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        nodeList.assign(nodes.begin(), nodes.begin() + totals.size());
+        nameList = names;
+    }
+
+    // strategies only frame the calls they caused, their cost is the self time of everything below them
+    std::vector<uint64> subtreeTime(totals.size(), 0);
+    std::vector<uint64> childCount(totals.size(), 0);
+    for (uint32 node = totals.size() - 1; node > 0; --node)
+    {
+        subtreeTime[node] += totals[node].selfTime;
+        subtreeTime[nodeList[node].parent] += subtreeTime[node];
+        childCount[nodeList[node].parent] += totals[node].count;
+    }
+
+    std::map<PerformanceMetric, std::map<std::string, PerformanceSummary>> data;
+    for (uint32 node = 1; node < totals.size(); ++node)
+    {
+        PerformanceNode const& pn = nodeList[node];
+        PerformanceSummary summary = totals[node];
+        if (pn.metric == PERF_MON_STRATEGY)
+        {
+            summary.totalTime = subtreeTime[node];
+            summary.count = childCount[node];
         }
+
+        if (!summary.count)
+            continue;
+
+        std::string name = nameList[pn.nameId];
+        if (pn.parent)
+            name += " [" + (fullStack ? GetPath(pn.parent, '|', true) : nameList[nodeList[pn.parent].nameId]) + "]";
+
+        data[pn.metric][name].Add(summary);
     }
-    else
+
+    if (data.empty())
+        return;
+
+    float baseTime = 0;
+    float tickCount = 1;
+    if (!perTick)
     {
-        float fullTickCount = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"]->count;
-        float fullTickTotalTime = data[PERF_MON_TOTAL]["PlayerbotAIBase::FullTick"]->totalTime;
+        for (auto& map : data[PERF_MON_TOTAL])
+            if (map.first.find("PlayerbotAI::UpdateAIInternal") != std::string::npos)
+                baseTime += map.second.totalTime;
 
         LOG_INFO(
             "playerbots",
-            "---------------------------------------[PER TICK]------------------------------------------------------");
-        LOG_INFO("playerbots",
-                 "percentage     time  |     min ..     max (      avg  of      count) - type      : name");
+            "--------------------------------------[TOTAL BOT]----------------------------------------------------------------------------");
+    }
+    else
+    {
+        auto fullTick = data[PERF_MON_TOTAL].find("PlayerbotAIBase::FullTick");
+        if (fullTick == data[PERF_MON_TOTAL].end() || !fullTick->second.count)
+        {
+            LOG_INFO("playerbots", "No full bot ticks recorded yet");
+            return;
+        }
+
+        tickCount = fullTick->second.count;
+        baseTime = fullTick->second.totalTime;
+
         LOG_INFO(
             "playerbots",
-            "-------------------------------------------------------------------------------------------------------");
+            "---------------------------------------[PER TICK]----------------------------------------------------------------------------");
+    }
 
-        for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-             i != data.end(); ++i)
-        {
-            std::map<std::string, PerformanceData*> pdMap = i->second;
+    LOG_INFO("playerbots",
+             "percentage     time  |     min ..     max (      avg  of      count) |     p50     p95     p99 - type      : name");
+    LOG_INFO(
+        "playerbots",
+        "-----------------------------------------------------------------------------------------------------------------------------");
 
-            std::string key;
-            switch (i->first)
-            {
-                case PERF_MON_TRIGGER:
-                    key = "Trigger";
-                    break;
-                case PERF_MON_VALUE:
-                    key = "Value";
-                    break;
-                case PERF_MON_ACTION:
-                    key = "Action";
-                    break;
-                case PERF_MON_RNDBOT:
-                    key = "RndBot";
-                    break;
-                case PERF_MON_TOTAL:
-                    key = "Total";
-                    break;
-                default:
-                    key = "?";
-            }
+    for (std::map<PerformanceMetric, std::map<std::string, PerformanceSummary>>::iterator i = data.begin();
+         i != data.end(); ++i)
+    {
+        std::string key = GetMetricName(i->first);
 
-            std::vector<std::string> names;
+        std::vector<PerformanceRow> rows;
+        for (std::map<std::string, PerformanceSummary>::iterator j = i->second.begin(); j != i->second.end(); ++j)
+        {
+            if (!perTick && i->first == PERF_MON_TOTAL &&
+                j->first.find("PlayerbotAI::UpdateAIInternal") == std::string::npos)
+                continue;
 
-            for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
-            {
-                names.push_back(j->first);
-            }
+            rows.push_back({j->first, j->second});
+        }
 
-            std::sort(names.begin(), names.end(),
-                      [pdMap](std::string const i, std::string const j)
-                      { return pdMap.at(i)->totalTime < pdMap.at(j)->totalTime; });
+        std::sort(rows.begin(), rows.end(),
+                  [](PerformanceRow const& i, PerformanceRow const& j)
+                  { return i.summary.totalTime < j.summary.totalTime; });
 
-            uint64 typeTotalTime = 0;
-            uint64 typeMinTime = 0xffffffffu;
-            uint64 typeMaxTime = 0;
-            uint32 typeCount = 0;
-            for (auto& name : names)
-            {
-                PerformanceData* pd = pdMap[name];
-                typeTotalTime += pd->totalTime;
-                typeCount += pd->count;
-                if (typeMinTime > pd->minTime)
-                    typeMinTime = pd->minTime;
-                if (typeMaxTime < pd->maxTime)
-                    typeMaxTime = pd->maxTime;
-                float perc = (float)pd->totalTime / fullTickTotalTime * 100.0f;
-                float time = (float)pd->totalTime / fullTickCount / 1000.0f;
-                float minTime = (float)pd->minTime / 1000.0f;
-                float maxTime = (float)pd->maxTime / 1000.0f;
-                float avg = (float)pd->totalTime / (float)pd->count / 1000.0f;
-                float amount = (float)pd->count / fullTickCount;
-                std::string disName = name;
-                if (!fullStack && disName.find("|") != std::string::npos)
-                    disName = disName.substr(0, disName.find("|")) + "]";
-                if (perc >= 0.1f || avg >= 0.25f || pd->maxTime > 1000)
-                {
-                    LOG_INFO("playerbots",
-                             "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}", perc,
-                             time, minTime, maxTime, avg, amount, key.c_str(), disName.c_str());
-                }
-            }
-            if (i->first != PERF_MON_TOTAL)
-            {
-                float tPerc = (float)typeTotalTime / (float)fullTickTotalTime * 100.0f;
-                float tTime = (float)typeTotalTime / fullTickCount / 1000.0f;
-                float tMinTime = (float)typeMinTime / 1000.0f;
-                float tMaxTime = (float)typeMaxTime / 1000.0f;
-                float tAvg = (float)typeTotalTime / (float)typeCount / 1000.0f;
-                float tAmount = (float)typeCount / fullTickCount;
-                LOG_INFO("playerbots", "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) - {:6}    : {}",
-                         tPerc, tTime, tMinTime, tMaxTime, tAvg, tAmount, key.c_str(), "Total");
-            }
-            LOG_INFO("playerbots", " ");
+        PerformanceSummary typeTotal;
+        for (PerformanceRow const& row : rows)
+        {
+            PerformanceSummary const& pd = row.summary;
+            typeTotal.Add(pd);
+
+            float perc = (float)pd.totalTime / baseTime * 100.0f;
+            float minTime = (float)pd.minTime / 1000.0f;
+            float maxTime = (float)pd.maxTime / 1000.0f;
+            float avg = (float)pd.totalTime / (float)pd.count / 1000.0f;
+
+            if (perc < 0.1f && avg < 0.25f && pd.maxTime <= 1000)
+                continue;
+
+            if (!perTick)
+                LOG_INFO("playerbots",
+                         "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) | {:7.1f} {:7.1f} {:7.1f} - {:6}    : {}",
+                         perc, (float)pd.totalTime / 1000000.0f, minTime, maxTime, avg, pd.count, pd.Percentile(0.5f),
+                         pd.Percentile(0.95f), pd.Percentile(0.99f), key.c_str(), row.name.c_str());
+            else
+                LOG_INFO("playerbots",
+                         "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) | {:7.1f} {:7.1f} {:7.1f} - {:6}    : {}",
+                         perc, (float)pd.totalTime / tickCount / 1000.0f, minTime, maxTime, avg, pd.count / tickCount,
+                         pd.Percentile(0.5f), pd.Percentile(0.95f), pd.Percentile(0.99f), key.c_str(),
+                         row.name.c_str());
         }
-    }
-}
 
-void PerformanceMonitor::Reset()
-{
-    for (std::map<PerformanceMetric, std::map<std::string, PerformanceData*>>::iterator i = data.begin();
-         i != data.end(); ++i)
-    {
-        std::map<std::string, PerformanceData*> pdMap = i->second;
-        for (std::map<std::string, PerformanceData*>::iterator j = pdMap.begin(); j != pdMap.end(); ++j)
+        // strategies frame triggers and actions that are already listed, a type total would count them twice
+        if (typeTotal.count && i->first != PERF_MON_STRATEGY && (!perTick || i->first != PERF_MON_TOTAL))
         {
-            PerformanceData* pd = j->second;
-            std::lock_guard<std::mutex> guard(pd->lock);
-            pd->minTime = 0;
-            pd->maxTime = 0;
-            pd->totalTime = 0;
-            pd->count = 0;
+            float tPerc = (float)typeTotal.totalTime / baseTime * 100.0f;
+            float tMinTime = (float)typeTotal.minTime / 1000.0f;
+            float tMaxTime = (float)typeTotal.maxTime / 1000.0f;
+            float tAvg = (float)typeTotal.totalTime / (float)typeTotal.count / 1000.0f;
+
+            if (!perTick)
+                LOG_INFO("playerbots",
+                         "{:7.3f}% {:10.3f}s | {:7.1f} .. {:7.1f} ({:10.3f} of {:10d}) | {:7.1f} {:7.1f} {:7.1f} - {:6}    : {}",
+                         tPerc, (float)typeTotal.totalTime / 1000000.0f, tMinTime, tMaxTime, tAvg, typeTotal.count,
+                         typeTotal.Percentile(0.5f), typeTotal.Percentile(0.95f), typeTotal.Percentile(0.99f),
+                         key.c_str(), "Total");
+            else
+                LOG_INFO("playerbots",
+                         "{:7.3f}% {:9.3f}ms | {:7.1f} .. {:7.1f} ({:10.3f} of {:10.2f}) | {:7.1f} {:7.1f} {:7.1f} - {:6}    : {}",
+                         tPerc, (float)typeTotal.totalTime / tickCount / 1000.0f, tMinTime, tMaxTime, tAvg,
+                         typeTotal.count / tickCount, typeTotal.Percentile(0.5f), typeTotal.Percentile(0.95f),
+                         typeTotal.Percentile(0.99f), key.c_str(), "Total");
         }
-    }
-}
 
-PerformanceMonitorOperation::PerformanceMonitorOperation(PerformanceData* data, std::string const name,
-                                                         PerformanceStack* stack)
-    : data(data), name(name), stack(stack)
-{
-    started = (std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()))
-                  .time_since_epoch();
+        LOG_INFO("playerbots", " ");
+    }
 }
 
-void PerformanceMonitorOperation::finish()
+bool PerformanceMonitor::WriteFlameGraph(std::string const fileName)
 {
-    std::chrono::microseconds finished =
-        (std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now()))
-            .time_since_epoch();
-    uint64 elapsed = (finished - started).count();
+    std::vector<PerformanceSummary> totals;
+    Collect(totals);
 
-    std::lock_guard<std::mutex> guard(data->lock);
-    if (elapsed > 0)
+    std::ofstream out(fileName, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
     {
-        if (!data->minTime || data->minTime > elapsed)
-            data->minTime = elapsed;
+        LOG_ERROR("playerbots", "Unable to open {} for the performance flame graph", fileName);
+        return false;
+    }
 
-        if (!data->maxTime || data->maxTime < elapsed)
-            data->maxTime = elapsed;
+    // folded stacks, one line per call path with its self time in microseconds
+    uint32 lines = 0;
+    for (uint32 node = 1; node < totals.size(); ++node)
+    {
+        if (!totals[node].selfTime)
+            continue;
 
-        data->totalTime += elapsed;
+        out << GetPath(node, ';', false) << " " << totals[node].selfTime << "\n";
+        ++lines;
     }
 
-    ++data->count;
+    LOG_INFO("playerbots", "Performance flame graph with {} call paths written to {}", lines, fileName);
+    return true;
+}
 
-    if (stack)
-    {
-        stack->erase(std::remove(stack->begin(), stack->end(), name), stack->end());
-    }
+void PerformanceMonitor::AddScheduledBots(uint32 updated, uint32 deferred)
+{
+    if (!sPlayerbotAIConfig->perfMonEnabled)
+        return;
+
+    scheduledBotsUpdated += updated;
+    scheduledBotsDeferred += deferred;
+}
+
+void PerformanceMonitor::Reset()
+{
+    scheduledBotsUpdated = 0;
+    scheduledBotsDeferred = 0;
 
-    delete this;
+    // every thread clears its own counters on its next record, stale threads are skipped until then
+    ++generation;
 }
@@ -6,24 +6,21 @@
 #ifndef _PLAYERBOT_PERFORMANCEMONITOR_H
 #define _PLAYERBOT_PERFORMANCEMONITOR_H
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <ctime>
 #include <map>
 #include <mutex>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include "Common.h"
 
-typedef std::vector<std::string> PerformanceStack;
+class PerformanceMonitorOperation;
 
-struct PerformanceData
-{
-    uint64 minTime;
-    uint64 maxTime;
-    uint64 totalTime;
-    uint32 count;
-    std::mutex lock;
-};
+typedef std::vector<PerformanceMonitorOperation*> PerformanceStack;
 
 enum PerformanceMetric
 {
@@ -31,20 +28,72 @@ enum PerformanceMetric
     PERF_MON_VALUE,
     PERF_MON_ACTION,
     PERF_MON_RNDBOT,
-    PERF_MON_TOTAL
+    PERF_MON_TOTAL,
+    PERF_MON_STRATEGY
+};
+
+// log2 buckets in microseconds, the last one is open ended
+#define PERF_MON_HISTOGRAM_BUCKETS 20
+#define PERF_MON_CHUNK_SIZE 256
+#define PERF_MON_MAX_CHUNKS 256
+
+// Counters of one call path on one thread. Only the owning thread writes them, readers only load.
+struct PerformanceData
+{
+    std::atomic<uint64> minTime{0};
+    std::atomic<uint64> maxTime{0};
+    std::atomic<uint64> totalTime{0};
+    std::atomic<uint64> selfTime{0};
+    std::atomic<uint64> count{0};
+    std::array<std::atomic<uint64>, PERF_MON_HISTOGRAM_BUCKETS> histogram{};
+};
+
+// Counters of one call path summed over all threads
+struct PerformanceSummary
+{
+    uint64 minTime = 0;
+    uint64 maxTime = 0;
+    uint64 totalTime = 0;
+    uint64 selfTime = 0;
+    uint64 count = 0;
+    std::array<uint64, PERF_MON_HISTOGRAM_BUCKETS> histogram{};
+
+    void Add(PerformanceSummary const& other);
+    float Percentile(float fraction) const;
+};
+
+struct PerformanceThreadData
+{
+    std::array<std::atomic<PerformanceData*>, PERF_MON_MAX_CHUNKS> chunks{};
+    std::atomic<uint32> generation{0};
+    std::unordered_map<std::string, uint32> nameIds;
+    std::unordered_map<uint64, uint32> nodeIds;
+    std::vector<PerformanceMonitorOperation*> freeOperations;
+    uint32 sampleSeed = 0;
+};
+
+// Call path node, id 0 is the root
+struct PerformanceNode
+{
+    uint32 parent;
+    uint32 nameId;
+    PerformanceMetric metric;
 };
 
 class PerformanceMonitorOperation
 {
 public:
-    PerformanceMonitorOperation(PerformanceData* data, std::string const name, PerformanceStack* stack);
     void finish();
 
 private:
-    PerformanceData* data;
-    std::string const name;
-    PerformanceStack* stack;
-    std::chrono::microseconds started;
+    friend class PerformanceMonitor;
+
+    uint32 node = 0;
+    uint32 weight = 0;
+    bool context = false;
+    PerformanceStack* stack = nullptr;
+    uint64 childTime = 0;
+    std::chrono::steady_clock::time_point started;
 };
 
 class PerformanceMonitor
@@ -59,14 +108,40 @@ public:
     }
 
 public:
+    // Registers a name once so hot callers can pass the id instead of building and hashing the string every call,
+    // ids start at 1 and 0 stands for no name
+    uint32 RegisterName(std::string const& name);
     PerformanceMonitorOperation* start(PerformanceMetric metric, std::string const name,
                                        PerformanceStack* stack = nullptr);
+    PerformanceMonitorOperation* start(PerformanceMetric metric, uint32 nameId, PerformanceStack* stack = nullptr);
+    // Puts a frame on the stack that attributes nested operations without timing or counting itself
+    PerformanceMonitorOperation* enter(PerformanceMetric metric, uint32 nameId, PerformanceStack* stack);
     void PrintStats(bool perTick = false, bool fullStack = false);
+    bool WriteFlameGraph(std::string const fileName);
     void Reset();
+    void AddScheduledBots(uint32 updated, uint32 deferred);
 
 private:
-    std::map<PerformanceMetric, std::map<std::string, PerformanceData*> > data;
+    friend class PerformanceMonitorOperation;
+
+    PerformanceMonitorOperation* Begin(PerformanceMetric metric, std::string const* name, uint32 nameId,
+                                       PerformanceStack* stack, bool context);
+    void Record(PerformanceMonitorOperation* op, uint64 elapsed);
+    PerformanceThreadData* GetThreadData();
+    PerformanceData* GetData(PerformanceThreadData* threadData, uint32 node);
+    uint32 GetNode(PerformanceThreadData* threadData, uint32 parent, PerformanceMetric metric, uint32 nameId);
+    void Collect(std::vector<PerformanceSummary>& totals);
+    std::string GetPath(uint32 node, char separator, bool reverse);
+
+    std::vector<std::string> names{""};
+    std::vector<PerformanceNode> nodes{{0, 0, PERF_MON_TOTAL}};
+    std::unordered_map<std::string, uint32> nameIds;
+    std::map<std::tuple<uint32, uint32, uint32>, uint32> nodeIds;
+    std::vector<PerformanceThreadData*> threads;
     std::mutex lock;
+    std::atomic<uint32> generation{0};
+    std::atomic<uint64> scheduledBotsUpdated{0};
+    std::atomic<uint64> scheduledBotsDeferred{0};
 };
 
 #define sPerformanceMonitor PerformanceMonitor::instance()
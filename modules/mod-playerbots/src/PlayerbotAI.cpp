@@ -440,9 +440,13 @@ void PlayerbotAI::UpdateAIInternal([[maybe_unused]] uint32 elapsed, bool minimal
     if (!bot || bot->IsBeingTeleported() || !bot->IsInWorld())
         return;
 
-    std::string const mapString = WorldPosition(bot).isOverworld() ? std::to_string(bot->GetMapId()) : "I";
-    PerformanceMonitorOperation* pmo =
-        sPerformanceMonitor->start(PERF_MON_TOTAL, "PlayerbotAI::UpdateAIInternal " + mapString);
+    // the name is only built while the monitor runs, the update is called for every bot each tick
+    PerformanceMonitorOperation* pmo = nullptr;
+    if (sPlayerbotAIConfig->perfMonEnabled)
+    {
+        std::string const mapString = WorldPosition(bot).isOverworld() ? std::to_string(bot->GetMapId()) : "I";
+        pmo = sPerformanceMonitor->start(PERF_MON_TOTAL, "PlayerbotAI::UpdateAIInternal " + mapString);
+    }
     ExternalEventHelper helper(aiObjectContext);
 
     // chat replies
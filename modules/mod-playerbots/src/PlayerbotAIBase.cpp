@@ -14,7 +14,8 @@ void PlayerbotAIBase::UpdateAI(uint32 elapsed, bool minimal)
     if (totalPmo)
         totalPmo->finish();
 
-    totalPmo = sPerformanceMonitor->start(PERF_MON_TOTAL, "PlayerbotAIBase::FullTick");
+    static uint32 const fullTickId = sPerformanceMonitor->RegisterName("PlayerbotAIBase::FullTick");
+    totalPmo = sPerformanceMonitor->start(PERF_MON_TOTAL, fullTickId);
 
     if (nextAICheckDelay > elapsed)
         nextAICheckDelay -= elapsed;
@@ -58,3 +59,10 @@ void PlayerbotAIBase::YieldThread(uint32 delay)
 bool PlayerbotAIBase::IsActive() { return nextAICheckDelay < sPlayerbotAIConfig->maxWaitForMove; }
 
 bool PlayerbotAIBase::IsBotAI() const { return _isBotAI; }
+
+uint32 PlayerbotAIBase::TakeDeferredElapsed()
+{
+    uint32 elapsed = deferredElapsed;
+    deferredElapsed = 0;
+    return elapsed;
+}
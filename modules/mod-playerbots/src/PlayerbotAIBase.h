@@ -9,6 +9,8 @@
 #include "Define.h"
 #include "PlayerbotAIConfig.h"
 
+class Map;
+
 class PlayerbotAIBase
 {
 public:
@@ -23,12 +25,21 @@ public:
     bool IsActive();
     bool IsBotAI() const;
 
+    // time collected while waiting for a turn of the PlayerbotScheduler
+    void DeferUpdate(uint32 elapsed) { deferredElapsed += elapsed; }
+    uint32 GetDeferredElapsed() const { return deferredElapsed; }
+    uint32 TakeDeferredElapsed();
+    Map* GetScheduledMap() const { return scheduledMap; }
+    void SetScheduledMap(Map* map) { scheduledMap = map; }
+
 protected:
     uint32 nextAICheckDelay;
     class PerformanceMonitorOperation* totalPmo = nullptr;
 
 private:
     bool _isBotAI;
+    uint32 deferredElapsed = 0;
+    Map* scheduledMap = nullptr;
 };
 
 #endif
@@ -250,6 +250,8 @@ void PlayerbotGuildMgr::DeleteBotGuilds()
     LOG_INFO("playerbots", "Deleting random bot guilds...");
     std::vector<uint32> randomBots;
 
+    sRandomPlayerbotMgr->FlushEventValues(true);
+
     PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BOT);
     stmt->SetData(0, "add");
     if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU AGPL v3 license, you may redistribute it
+ * and/or modify it under version 3 of the License, or (at your option), any later version.
+ */
+
+#include "PlayerbotPerception.h"
+
+#include <boost/functional/hash.hpp>
+#include <cmath>
+#include <tuple>
+
+#include "DataMap.h"
+#include "GameObject.h"
+#include "GameTime.h"
+#include "Map.h"
+#include "Unit.h"
+
+// side of the areas searches are shared in, bots in one area use the same object lists
+#define PERCEPTION_AREA_SIZE 20.0f
+// searched ranges are rounded up to this step so values with close ranges share a list
+#define PERCEPTION_RANGE_STEP 5.0f
+// smaller searches go to the grid, the shared radius adds a whole area to them and costs more than it saves
+#define PERCEPTION_MIN_RANGE 50.0f
+
+namespace
+{
+    // keeps what lies within the shared radius, the grid cells visited reach further
+    struct PerceptionRangeCheck
+    {
+        PerceptionRangeCheck(float x, float y, float radius) : x(x), y(y), radiusSq(radius * radius) {}
+
+        bool operator()(WorldObject* object) { return object->GetExactDist2dSq(x, y) <= radiusSq; }
+
+        float x;
+        float y;
+        float radiusSq;
+    };
+
+    // area cell x, area cell y, phase mask
+    typedef std::tuple<int32, int32, uint32> PerceptionCellKey;
+    // area cell x, area cell y, phase mask, rounded range
+    typedef std::tuple<int32, int32, uint32, uint32> PerceptionAreaKey;
+
+    // the searches of a lone bot go to the grid, they are shared once a second bot searches in the same area
+    struct PerceptionCell
+    {
+        ObjectGuid firstSearcher;
+        bool shared = false;
+    };
+
+    struct PerceptionArea
+    {
+        std::vector<Unit*> units;
+        std::vector<GameObject*> gameObjects;
+        bool unitsFound = false;
+        bool gameObjectsFound = false;
+    };
+
+    thread_local Map* updatingMap = nullptr;
+}
+
+// shared searches of one map, only touched by the thread updating that map
+class PlayerbotMapPerception : public DataMap::Base
+{
+public:
+    std::unordered_map<PerceptionCellKey, PerceptionCell, boost::hash<PerceptionCellKey>> cells;
+    std::unordered_map<PerceptionAreaKey, PerceptionArea, boost::hash<PerceptionAreaKey>> areas;
+    // world tick the areas were searched in, in case a map update ends without the map update hook
+    Milliseconds searchTime = 0ms;
+};
+
+struct PerceptionAreaSearch
+{
+    PerceptionArea* area;
+    float x;
+    float y;
+    float radius;
+};
+
+static bool GetArea(WorldObject* searcher, float range, PerceptionAreaSearch& search)
+{
+    Map* map = searcher->FindMap();
+    if (!map || map != updatingMap || range < PERCEPTION_MIN_RANGE)
+        return false;
+
+    int32 cellX = int32(std::floor(searcher->GetPositionX() / PERCEPTION_AREA_SIZE));
+    int32 cellY = int32(std::floor(searcher->GetPositionY() / PERCEPTION_AREA_SIZE));
+    uint32 steps = uint32(std::ceil(range / PERCEPTION_RANGE_STEP));
+
+    PlayerbotMapPerception* perception = map->CustomData.GetDefault<PlayerbotMapPerception>("PlayerbotPerception");
+    if (perception->searchTime != GameTime::GetGameTimeMS())
+    {
+        perception->cells.clear();
+        perception->areas.clear();
+        perception->searchTime = GameTime::GetGameTimeMS();
+    }
+
+    PerceptionCell& cell = perception->cells[PerceptionCellKey(cellX, cellY, searcher->GetPhaseMask())];
+    if (!cell.shared)
+    {
+        if (!cell.firstSearcher || cell.firstSearcher == searcher->GetGUID())
+        {
+            cell.firstSearcher = searcher->GetGUID();
+            return false;
+        }
+
+        cell.shared = true;
+    }
+
+    PerceptionAreaKey key(cellX, cellY, searcher->GetPhaseMask(), steps);
+    search.area = &perception->areas[key];
+
+    // the area is searched from its center, far enough to cover the range from any point in it
+    search.x = (cellX + 0.5f) * PERCEPTION_AREA_SIZE;
+    search.y = (cellY + 0.5f) * PERCEPTION_AREA_SIZE;
+    search.radius = steps * PERCEPTION_RANGE_STEP + PERCEPTION_AREA_SIZE;
+
+    return true;
+}
+
+PlayerbotPerception* PlayerbotPerception::instance()
+{
+    static PlayerbotPerception instance;
+    return &instance;
+}
+
+PlayerbotPerception::Scope::Scope(Map* map) : _previous(updatingMap) { updatingMap = map; }
+
+PlayerbotPerception::Scope::~Scope() { updatingMap = _previous; }
+
+std::vector<Unit*> const* PlayerbotPerception::GetUnits(WorldObject* searcher, float range)
+{
+    PerceptionAreaSearch search;
+    if (!GetArea(searcher, range, search))
+        return nullptr;
+
+    if (!search.area->unitsFound)
+    {
+        PerceptionRangeCheck check(search.x, search.y, search.radius);
+        Acore::UnitListSearcher<PerceptionRangeCheck> unitSearcher(searcher, search.area->units, check);
+        Cell::VisitObjects(search.x, search.y, searcher->GetMap(), unitSearcher, search.radius);
+        search.area->unitsFound = true;
+    }
+
+    return &search.area->units;
+}
+
+std::vector<GameObject*> const* PlayerbotPerception::GetGameObjects(WorldObject* searcher, float range)
+{
+    PerceptionAreaSearch search;
+    if (!GetArea(searcher, range, search))
+        return nullptr;
+
+    if (!search.area->gameObjectsFound)
+    {
+        PerceptionRangeCheck check(search.x, search.y, search.radius);
+        Acore::GameObjectListSearcher<PerceptionRangeCheck> gameObjectSearcher(searcher, search.area->gameObjects,
+                                                                               check);
+        Cell::VisitObjects(search.x, search.y, searcher->GetMap(), gameObjectSearcher, search.radius);
+        search.area->gameObjectsFound = true;
+    }
+
+    return &search.area->gameObjects;
+}
+
+void PlayerbotPerception::Reset(Map* map)
+{
+    if (PlayerbotMapPerception* perception = map->CustomData.Get<PlayerbotMapPerception>("PlayerbotPerception"))
+    {
+        perception->cells.clear();
+        perception->areas.clear();
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU AGPL v3 license, you may redistribute it
+ * and/or modify it under version 3 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_PERCEPTION_H
+#define _PLAYERBOT_PERCEPTION_H
+
+#include "CellImpl.h"
+#include "Common.h"
+#include "GridNotifiers.h"
+#include "GridNotifiersImpl.h"
+
+class GameObject;
+class Map;
+class Unit;
+class WorldObject;
+
+/**
+ * @brief Shares the grid searches of the bots on a map within one map update
+ *
+ * Bots standing close together search nearly the same cells for their values. While a map is
+ * updating, the objects around a small area are collected once and every bot in that area
+ * filters the shared list with its own check instead of visiting the grid again. Only wide
+ * searches are shared, and only once a second bot searches in the area. The lists are dropped
+ * before the scheduled bots update, at the end of the map update and whenever a player leaves the map. Other units and
+ * game objects go through the map remove list, which is only processed after the update. The
+ * checks have to test the range themselves, as the shared lists cover more than it. Outside of a map update the
+ * searches go to the grid as before.
+ */
+class PlayerbotPerception
+{
+public:
+    static PlayerbotPerception* instance();
+
+    /**
+     * @brief Marks the current thread as updating the map, searches on it are shared while it lives
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(Map* map);
+        ~Scope();
+
+    private:
+        Map* _previous;
+    };
+
+    /**
+     * @brief Append the units within range of searcher that pass check, like a UnitListSearcher visit
+     */
+    template <class Check, class Container>
+    void FindUnits(WorldObject* searcher, float range, Check& check, Container& targets)
+    {
+        if (std::vector<Unit*> const* units = GetUnits(searcher, range))
+        {
+            for (Unit* unit : *units)
+                if (check(unit))
+                    targets.push_back(unit);
+
+            return;
+        }
+
+        Acore::UnitListSearcher<Check> unitSearcher(searcher, targets, check);
+        Cell::VisitObjects(searcher, unitSearcher, range);
+    }
+
+    /**
+     * @brief Append the game objects within range of searcher that pass check, like a GameObjectListSearcher visit
+     */
+    template <class Check, class Container>
+    void FindGameObjects(WorldObject* searcher, float range, Check& check, Container& targets)
+    {
+        if (std::vector<GameObject*> const* gameObjects = GetGameObjects(searcher, range))
+        {
+            for (GameObject* gameObject : *gameObjects)
+                if (check(gameObject))
+                    targets.push_back(gameObject);
+
+            return;
+        }
+
+        Acore::GameObjectListSearcher<Check> gameObjectSearcher(searcher, targets, check);
+        Cell::VisitObjects(searcher, gameObjectSearcher, range);
+    }
+
+    /**
+     * @brief Drop the shared searches of the map, called when objects may have moved or a player leaves it
+     */
+    void Reset(Map* map);
+
+private:
+    std::vector<Unit*> const* GetUnits(WorldObject* searcher, float range);
+    std::vector<GameObject*> const* GetGameObjects(WorldObject* searcher, float range);
+};
+
+#define sPlayerbotPerception PlayerbotPerception::instance()
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU AGPL v3 license, you may redistribute it
+ * and/or modify it under version 3 of the License, or (at your option), any later version.
+ */
+
+#include "PlayerbotScheduler.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "DataMap.h"
+#include "Map.h"
+#include "Playerbots.h"
+
+enum PlayerbotSchedulePriority : uint8
+{
+    SCHEDULE_PRIORITY_COMBAT_WITH_PLAYER = 0,
+    SCHEDULE_PRIORITY_GROUPED_WITH_PLAYER = 1,
+    SCHEDULE_PRIORITY_OTHER = 2
+};
+
+// bots waiting for their turn on one map, only touched by the thread updating that map
+class PlayerbotMapSchedule : public DataMap::Base
+{
+public:
+    std::vector<ObjectGuid> bots;
+};
+
+static bool IsRealPlayer(Player* player)
+{
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(player);
+    return !botAI || botAI->IsRealPlayer();
+}
+
+PlayerbotScheduler* PlayerbotScheduler::instance()
+{
+    static PlayerbotScheduler instance;
+    return &instance;
+}
+
+bool PlayerbotScheduler::Schedule(Player* bot, PlayerbotAI* botAI, uint32 elapsed)
+{
+    botAI->DeferUpdate(elapsed);
+
+    Map* map = bot->FindMap();
+    if (!sPlayerbotAIConfig->botAIBudgetPerMap || botAI->IsRealPlayer() || !map)
+    {
+        // still queued when the budget was switched off by a config reload, leave the queue so the
+        // map pass does not update the bot a second time, the time waited goes to this update
+        botAI->SetScheduledMap(nullptr);
+        return false;
+    }
+
+    // bots that changed maps are queued again, the entry on the old map is dropped there
+    if (botAI->GetScheduledMap() != map)
+    {
+        map->CustomData.GetDefault<PlayerbotMapSchedule>("PlayerbotScheduler")->bots.push_back(bot->GetGUID());
+        botAI->SetScheduledMap(map);
+    }
+
+    return true;
+}
+
+void PlayerbotScheduler::Update(Map* map)
+{
+    PlayerbotMapSchedule* schedule = map->CustomData.Get<PlayerbotMapSchedule>("PlayerbotScheduler");
+    if (!schedule || schedule->bots.empty())
+        return;
+
+    // switched off by a config reload, the bots left in the queue update right after Player::Update again
+    if (!sPlayerbotAIConfig->botAIBudgetPerMap)
+    {
+        schedule->bots.clear();
+        return;
+    }
+
+    struct ScheduledBot
+    {
+        ObjectGuid guid;
+        uint8 priority;
+        uint32 waited;
+    };
+
+    std::vector<ScheduledBot> bots;
+    bots.reserve(schedule->bots.size());
+    for (ObjectGuid const& guid : schedule->bots)
+    {
+        Player* bot = ObjectAccessor::GetPlayer(map, guid);
+        if (!bot)
+            continue;
+
+        PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
+        if (!botAI || botAI->GetScheduledMap() != map)
+            continue;
+
+        bots.push_back({guid, GetPriority(bot, botAI), botAI->GetDeferredElapsed()});
+    }
+
+    std::sort(bots.begin(), bots.end(),
+              [](ScheduledBot const& left, ScheduledBot const& right)
+              {
+                  if (left.priority != right.priority)
+                      return left.priority < right.priority;
+
+                  return left.waited > right.waited;
+              });
+
+    schedule->bots.clear();
+
+    uint32 updated = 0;
+    uint32 deferred = 0;
+    std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+    std::chrono::milliseconds budget(sPlayerbotAIConfig->botAIBudgetPerMap);
+
+    for (ScheduledBot const& scheduled : bots)
+    {
+        // looked up again, an AI update may have moved other bots away
+        Player* bot = ObjectAccessor::GetPlayer(map, scheduled.guid);
+        PlayerbotAI* botAI = bot ? GET_PLAYERBOT_AI(bot) : nullptr;
+        if (!botAI || botAI->GetScheduledMap() != map)
+            continue;
+
+        // bots fighting with real players always get their turn
+        if (scheduled.priority != SCHEDULE_PRIORITY_COMBAT_WITH_PLAYER &&
+            std::chrono::steady_clock::now() - started >= budget)
+        {
+            schedule->bots.push_back(scheduled.guid);
+            ++deferred;
+            continue;
+        }
+
+        botAI->SetScheduledMap(nullptr);
+        botAI->UpdateAI(botAI->TakeDeferredElapsed());
+        ++updated;
+    }
+
+    sPerformanceMonitor->AddScheduledBots(updated, deferred);
+}
+
+uint8 PlayerbotScheduler::GetPriority(Player* bot, PlayerbotAI* botAI) const
+{
+    bool groupedWithPlayer = botAI->HasRealPlayerMaster();
+    if (!groupedWithPlayer)
+    {
+        if (Group* group = bot->GetGroup())
+        {
+            for (GroupReference* ref = group->GetFirstMember(); ref; ref = ref->next())
+            {
+                Player* member = ref->GetSource();
+                if (member && member != bot && IsRealPlayer(member))
+                {
+                    groupedWithPlayer = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (bot->IsInCombat())
+    {
+        if (groupedWithPlayer)
+            return SCHEDULE_PRIORITY_COMBAT_WITH_PLAYER;
+
+        if (Unit* victim = bot->GetVictim())
+            if (Player* player = victim->GetCharmerOrOwnerPlayerOrPlayerItself())
+                if (IsRealPlayer(player))
+                    return SCHEDULE_PRIORITY_COMBAT_WITH_PLAYER;
+    }
+
+    return groupedWithPlayer ? SCHEDULE_PRIORITY_GROUPED_WITH_PLAYER : SCHEDULE_PRIORITY_OTHER;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2016+ AzerothCore <www.azerothcore.org>, released under GNU AGPL v3 license, you may redistribute it
+ * and/or modify it under version 3 of the License, or (at your option), any later version.
+ */
+
+#ifndef _PLAYERBOT_SCHEDULER_H
+#define _PLAYERBOT_SCHEDULER_H
+
+#include "Common.h"
+
+class Map;
+class Player;
+class PlayerbotAI;
+
+/**
+ * @brief Runs the bot AI of each map within a time budget per map update
+ *
+ * Instead of updating their AI right after Player::Update, bots are queued on their map and
+ * updated together from the map update hook, highest priority first:
+ * - bots in combat alongside or against a real player
+ * - bots grouped with a real player
+ * - everything else
+ * Within a priority, bots that waited longest go first. Once the budget of the map update is
+ * spent, lower priority bots stay queued and collect their elapsed time for the next turn.
+ */
+class PlayerbotScheduler
+{
+public:
+    static PlayerbotScheduler* instance();
+
+    /**
+     * @brief Queue the bot for the AI phase of its map
+     *
+     * @return false if the scheduler is disabled and the AI should be updated right away with
+     * PlayerbotAIBase::TakeDeferredElapsed()
+     */
+    bool Schedule(Player* bot, PlayerbotAI* botAI, uint32 elapsed);
+
+    /**
+     * @brief Update the AI of the bots queued on the map, called from the map update hook once the
+     * objects of the map were updated and before their changes are sent
+     */
+    void Update(Map* map);
+
+private:
+    uint8 GetPriority(Player* bot, PlayerbotAI* botAI) const;
+};
+
+#define sPlayerbotScheduler PlayerbotScheduler::instance()
+
+#endif
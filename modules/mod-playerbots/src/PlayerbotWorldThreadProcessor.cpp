@@ -11,7 +11,7 @@
 #include <algorithm>
 
 PlayerbotWorldThreadProcessor::PlayerbotWorldThreadProcessor()
-    : m_enabled(true), m_maxQueueSize(10000), m_batchSize(100), m_queueWarningThreshold(80),
+    : m_queueSize(0), m_enabled(true), m_maxQueueSize(10000), m_batchSize(100), m_queueWarningThreshold(80),
       m_timeSinceLastUpdate(0), m_updateInterval(50)  // Process at least every 50ms
 {
     LOG_INFO("playerbots", "PlayerbotWorldThreadProcessor initialized");
@@ -54,11 +54,11 @@ bool PlayerbotWorldThreadProcessor::QueueOperation(std::unique_ptr<PlayerbotOper
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
-    // Check if queue is full
-    if (m_operationQueue.size() >= m_maxQueueSize)
+    // Reserve a place first, so concurrent producers cannot overshoot the limit together
+    if (m_queueSize.fetch_add(1, std::memory_order_relaxed) >= m_maxQueueSize)
     {
+        m_queueSize.fetch_sub(1, std::memory_order_relaxed);
+
         LOG_ERROR("playerbots",
                   "PlayerbotWorldThreadProcessor queue is full ({} operations). Dropping operation: {}",
                   m_maxQueueSize, operation->GetName());
@@ -68,15 +68,8 @@ bool PlayerbotWorldThreadProcessor::QueueOperation(std::unique_ptr<PlayerbotOper
         return false;
     }
 
-    // Queue the operation
-    m_operationQueue.push(std::move(operation));
-
-    // Update statistics
-    {
-        std::lock_guard<std::mutex> statsLock(m_statsMutex);
-        m_stats.currentQueueSize = static_cast<uint32>(m_operationQueue.size());
-        m_stats.maxQueueSize = std::max(m_stats.maxQueueSize, m_stats.currentQueueSize);
-    }
+    // Queue the operation, the queue takes ownership
+    m_operationQueue.Enqueue(operation.release());
 
     return true;
 }
@@ -88,18 +81,21 @@ void PlayerbotWorldThreadProcessor::ProcessBatch()
     batch.reserve(m_batchSize);
 
     {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
+        // The backlog only grows between batches, so its peak is seen here
+        uint32 queueSize = GetQueueSize();
 
         // Extract up to batchSize operations
-        while (!m_operationQueue.empty() && batch.size() < m_batchSize)
+        PlayerbotOperation* operation = nullptr;
+        while (batch.size() < m_batchSize && m_operationQueue.Dequeue(operation))
         {
-            batch.push_back(std::move(m_operationQueue.front()));
-            m_operationQueue.pop();
+            batch.emplace_back(operation);
+            m_queueSize.fetch_sub(1, std::memory_order_relaxed);
         }
 
-        // Update current queue size stat
+        // Update queue size stats
         std::lock_guard<std::mutex> statsLock(m_statsMutex);
-        m_stats.currentQueueSize = static_cast<uint32>(m_operationQueue.size());
+        m_stats.currentQueueSize = GetQueueSize();
+        m_stats.maxQueueSize = std::max(m_stats.maxQueueSize, queueSize);
     }
 
     // Execute operations outside of lock to avoid blocking queue
@@ -187,22 +183,21 @@ void PlayerbotWorldThreadProcessor::CheckQueueHealth()
 
 uint32 PlayerbotWorldThreadProcessor::GetQueueSize() const
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-    return static_cast<uint32>(m_operationQueue.size());
+    return m_queueSize.load(std::memory_order_relaxed);
 }
 
 void PlayerbotWorldThreadProcessor::ClearQueue()
 {
-    std::lock_guard<std::mutex> lock(m_queueMutex);
-
-    uint32 cleared = static_cast<uint32>(m_operationQueue.size());
+    uint32 cleared = GetQueueSize();
     if (cleared > 0)
         LOG_INFO("playerbots", "Clearing {} queued operations", cleared);
 
     // Clear the queue
-    while (!m_operationQueue.empty())
+    PlayerbotOperation* operation = nullptr;
+    while (m_operationQueue.Dequeue(operation))
     {
-        m_operationQueue.pop();
+        delete operation;
+        m_queueSize.fetch_sub(1, std::memory_order_relaxed);
     }
 
     // Reset queue size stat
@@ -7,11 +7,12 @@
 #define _PLAYERBOT_WORLD_THREAD_PROCESSOR_H
 
 #include "Common.h"
+#include "MPSCQueue.h"
 #include "PlayerbotOperation.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
-#include <queue>
 
 /**
  * @brief Processes thread-unsafe bot operations in the world thread
@@ -23,8 +24,8 @@
  * Architecture:
  * - Map threads queue operations via QueueOperation()
  * - World thread processes operations via Update() (called from WorldScript::OnUpdate)
- * - Operations are processed in priority order
- * - Thread-safe queue protected by mutex
+ * - Operations are processed in the order they were queued
+ * - Lock-free multi-producer, single-consumer queue, so map threads never wait on each other
  *
  * Usage:
  *   auto op = std::make_unique<MyOperation>(botGuid, params);
@@ -71,7 +72,8 @@ public:
     /**
      * @brief Clear all queued operations
      *
-     * Used during shutdown or emergency situations.
+     * Used during shutdown or emergency situations. Must be called from the world thread,
+     * the only consumer of the queue.
      */
     void ClearQueue();
 
@@ -118,9 +120,9 @@ private:
      */
     void CheckQueueHealth();
 
-    // Thread-safe queue
-    mutable std::mutex m_queueMutex;
-    std::queue<std::unique_ptr<PlayerbotOperation>> m_operationQueue;
+    // Thread-safe queue, owns the queued operations
+    MPSCQueue<PlayerbotOperation> m_operationQueue;
+    std::atomic<uint32> m_queueSize;
 
     // Configuration
     bool m_enabled;
@@ -26,6 +26,8 @@
 #include "PlayerScript.h"
 #include "PlayerbotAIConfig.h"
 #include "PlayerbotGuildMgr.h"
+#include "PlayerbotPerception.h"
+#include "PlayerbotScheduler.h"
 #include "PlayerbotSpellCache.h"
 #include "PlayerbotWorldThreadProcessor.h"
 #include "RandomPlayerbotMgr.h"
@@ -52,7 +54,11 @@ public:
 
     void OnDatabasesKeepAlive() override { PlayerbotsDatabase.KeepAlive(); }
 
-    void OnDatabasesClosing() override { PlayerbotsDatabase.Close(); }
+    void OnDatabasesClosing() override
+    {
+        sRandomPlayerbotMgr->FlushEventValues(true);
+        PlayerbotsDatabase.Close();
+    }
 
     void OnDatabaseWarnAboutSyncQueries(bool apply) override { PlayerbotsDatabase.WarnAboutSyncQueries(apply); }
 
@@ -174,7 +180,10 @@ public:
     {
         if (PlayerbotAI* botAI = GET_PLAYERBOT_AI(player))
         {
-            botAI->UpdateAI(diff);
+            PlayerbotPerception::Scope perceptionScope(player->FindMap());
+
+            if (!sPlayerbotScheduler->Schedule(player, botAI, diff))
+                botAI->UpdateAI(botAI->TakeDeferredElapsed());
         }
 
         if (PlayerbotMgr* playerbotMgr = GET_PLAYERBOT_MGR(player))
@@ -374,6 +383,40 @@ public:
     {
         sPlayerbotWorldProcessor->Update(diff);
         sRandomPlayerbotMgr->UpdateAI(diff);  // World thread only
+        sRandomPlayerbotMgr->UpdateEventValues(diff);
+    }
+};
+
+class PlayerbotsMapScript : public AllMapScript
+{
+public:
+    PlayerbotsMapScript() : AllMapScript("PlayerbotsMapScript", {
+        ALLMAPHOOK_ON_PLAYER_LEAVE_ALL,
+        ALLMAPHOOK_ON_MAP_OBJECTS_UPDATED
+    }) {}
+
+    void OnPlayerLeaveAll(Map* map, Player* player) override
+    {
+        // queued again on the next map
+        if (PlayerbotAI* botAI = GET_PLAYERBOT_AI(player))
+            botAI->SetScheduledMap(nullptr);
+
+        // the player may be deleted right after this, even in the middle of the map update
+        sPlayerbotPerception->Reset(map);
+    }
+
+    // before the map sends object updates and moves, so what the bots do goes out in this map update
+    void OnMapObjectsUpdated(Map* map, uint32 /*diff*/) override
+    {
+        // the creatures have moved since the players updated
+        sPlayerbotPerception->Reset(map);
+
+        {
+            PlayerbotPerception::Scope perceptionScope(map);
+            sPlayerbotScheduler->Update(map);
+        }
+
+        sPlayerbotPerception->Reset(map);
     }
 };
 
@@ -512,6 +555,7 @@ void AddPlayerbotsScripts()
     new PlayerbotsMiscScript();
     new PlayerbotsServerScript();
     new PlayerbotsWorldScript();
+    new PlayerbotsMapScript();
     new PlayerbotsScript();
     new PlayerBotsBGScript();
     AddPlayerbotsSecureLoginScripts();
@@ -906,61 +906,9 @@ void RandomItemMgr::BuildItemInfoCache()
         return;
     }
 
-    // vendor items
-    LOG_INFO("playerbots", "Loading vendor item list...");
-
-    std::set<uint32> vendorItems;
-    vendorItems.clear();
-    if (QueryResult result = WorldDatabase.Query("SELECT item FROM npc_vendor"))
-    {
-        do
-        {
-            Field* fields = result->Fetch();
-            int32 entry = fields[0].Get<int32>();
-            if (entry <= 0)
-                continue;
-
-            vendorItems.insert(entry);
-        } while (result->NextRow());
-    }
-
-    LOG_INFO("playerbots", "Loaded {} vendor items...", vendorItems.size());
-
-    // calculate drop source
-    LOG_INFO("playerbots", "Loading loot templates...");
-    DropMap* dropMap = new DropMap;
-
-    if (CreatureTemplateContainer const* creatures = sObjectMgr->GetCreatureTemplates())
-    {
-        for (CreatureTemplateContainer::const_iterator itr = creatures->begin(); itr != creatures->end(); ++itr)
-        {
-            uint32 sEntry = itr->first;
-            if (LootTemplateAccess const* lTemplateA =
-                    DropMapValue::GetLootTemplate(ObjectGuid::Create<HighGuid::Unit>(sEntry, uint32(1)), LOOT_CORPSE))
-                for (auto const& lItem : lTemplateA->Entries)
-                    dropMap->insert(std::make_pair(lItem->itemid, sEntry));
-        }
-    }
-
-    if (GameObjectTemplateContainer const* gameobjects = sObjectMgr->GetGameObjectTemplates())
-    {
-        for (auto const& itr : *gameobjects)
-        {
-            uint32 sEntry = itr.first;
-            if (LootTemplateAccess const* lTemplateA = DropMapValue::GetLootTemplate(
-                    ObjectGuid::Create<HighGuid::GameObject>(sEntry, uint32(1)), LOOT_CORPSE))
-                for (auto const& lItem : lTemplateA->Entries)
-                    dropMap->insert(std::make_pair(lItem->itemid, sEntry));
-        }
-    }
-
-    LOG_INFO("playerbots", "Loaded {} loot templates...", dropMap->size());
-
     ItemTemplateContainer const* itemTemplate = sObjectMgr->GetItemTemplateStore();
     LOG_INFO("playerbots", "Calculating stat weights for {} items...", itemTemplate->size());
 
-    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
-
     for (auto const& itr : *itemTemplate)
     {
         ItemTemplate const* proto = &itr.second;
@@ -1263,8 +1211,6 @@ void RandomItemMgr::BuildItemInfoCache()
 
         // itemInfoCache[cacheInfo.itemId] = std::move(cacheInfo);
     }
-
-    PlayerbotsDatabase.CommitTransaction(trans);
 }
 
 uint32 RandomItemMgr::CalculateStatWeight(uint8 playerclass, uint8 spec, ItemTemplate const* proto)
@@ -2307,25 +2253,42 @@ void RandomItemMgr::BuildAmmoCache()
 
     LOG_INFO("server.loading", "Building ammo cache for {} levels", maxLevel);
 
+    // One pass over the item store instead of a world query per level and ammo type
+    std::vector<ItemTemplate const*> ammo;
+    ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
+    for (auto const& itr : *itemTemplates)
+    {
+        ItemTemplate const* proto = &itr.second;
+        if (proto->Class != ITEM_CLASS_PROJECTILE || proto->SubClass < ITEM_SUBCLASS_ARROW ||
+            proto->SubClass > ITEM_SUBCLASS_BULLET)
+            continue;
+
+        if (proto->Duration || proto->HasFlag(ITEM_FLAG_DEPRECATED) || !proto->Damage[0].DamageMin ||
+            !proto->RequiredLevel)
+            continue;
+
+        ammo.push_back(proto);
+    }
+
+    std::sort(ammo.begin(), ammo.end(),
+              [](ItemTemplate const* a, ItemTemplate const* b)
+              {
+                  if (a->Stackable != b->Stackable)
+                      return a->Stackable > b->Stackable;
+
+                  return a->ItemLevel > b->ItemLevel;
+              });
+
     uint32 counter = 0;
     for (uint32 level = 1; level <= maxLevel; level += 1)
     {
-        for (uint32 subClass = ITEM_SUBCLASS_ARROW; subClass <= ITEM_SUBCLASS_BULLET; subClass++)
+        for (ItemTemplate const* proto : ammo)
         {
-            QueryResult results = WorldDatabase.Query(
-                "SELECT entry FROM item_template WHERE class = {} AND subclass = {} AND RequiredLevel <= {} AND duration = 0 "
-                "AND (Flags & 16) = 0 AND dmg_min1 != 0 AND RequiredLevel != 0  "
-                "ORDER BY stackable DESC, ItemLevel DESC",
-                ITEM_CLASS_PROJECTILE, subClass, level);
-            if (!results)
+            if (proto->RequiredLevel > level)
                 continue;
-            do
-            {
-                Field* fields = results->Fetch();
-                uint32 entry = fields[0].Get<uint32>();
-                ammoCache[level][subClass].push_back(entry);
-                ++counter;
-            } while (results->NextRow());
+
+            ammoCache[level][proto->SubClass].push_back(proto->ItemId);
+            ++counter;
         }
     }
 
@@ -2341,72 +2304,61 @@ void RandomItemMgr::BuildPotionCache()
     LOG_INFO("playerbots", "Building potion cache for {} levels", maxLevel);
 
     ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
-
     uint32 counter = 0;
-    for (uint32 level = 1; level <= maxLevel; level++)
-    {
-        uint32 effects[] = {SPELL_EFFECT_HEAL, SPELL_EFFECT_ENERGIZE};
-        for (uint8 i = 0; i < 2; ++i)
-        {
-            uint32 effect = effects[i];
-
-            for (auto const& itr : *itemTemplates)
-            {
-                ItemTemplate const* proto = &itr.second;
-                if (!proto)
-                    continue;
 
-                if (proto->Class != ITEM_CLASS_CONSUMABLE ||
-                    (proto->SubClass != ITEM_SUBCLASS_POTION && proto->SubClass != ITEM_SUBCLASS_FLASK) ||
-                    proto->Bonding != NO_BIND)
-                    continue;
+    // Items are checked once and then added to every level they fit
+    for (auto const& itr : *itemTemplates)
+    {
+        ItemTemplate const* proto = &itr.second;
+        if (!proto)
+            continue;
 
-                uint32 requiredLevel = proto->RequiredLevel;
-                if (requiredLevel > level || (level > 13 && requiredLevel < level - 13))
-                    continue;
+        if (proto->Class != ITEM_CLASS_CONSUMABLE ||
+            (proto->SubClass != ITEM_SUBCLASS_POTION && proto->SubClass != ITEM_SUBCLASS_FLASK) ||
+            proto->Bonding != NO_BIND)
+            continue;
 
-                if (proto->RequiredSkill)
-                    continue;
+        if (proto->RequiredSkill)
+            continue;
 
-                if (proto->Area || proto->Map || proto->RequiredCityRank || proto->RequiredHonorRank)
-                    continue;
+        if (proto->Area || proto->Map || proto->RequiredCityRank || proto->RequiredHonorRank)
+            continue;
 
-                if (proto->Duration & 0x80000000)
-                    continue;
+        if (proto->Duration & 0x80000000)
+            continue;
 
-                if (proto->AllowableClass != -1)
-                    continue;
+        if (proto->AllowableClass != -1)
+            continue;
 
-                bool hybrid = false;
-                SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[0].SpellId);
-                if (!spellInfo)
-                    continue;
-                // do not accept hybrid potion
-                for (uint8 i = 1; i < 3; i++)
-                {
-                    if (spellInfo->Effects[i].Effect != 0)
-                    {
-                        hybrid = true;
-                        break;
-                    }
-                }
-                if (hybrid)
-                    continue;
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(proto->Spells[0].SpellId);
+        if (!spellInfo)
+            continue;
 
-                if (spellInfo->Effects[0].Effect == effect)
-                    potionCache[level][effect].push_back(itr.first);
+        bool hybrid = false;
+        for (uint8 i = 1; i < 3; i++)
+        {
+            if (spellInfo->Effects[i].Effect != 0)
+            {
+                hybrid = true;
+                break;
             }
         }
-    }
 
-    for (uint32 level = 1; level <= maxLevel; level++)
-    {
-        uint32 effects[] = {SPELL_EFFECT_HEAL, SPELL_EFFECT_ENERGIZE};
-        for (uint8 i = 0; i < 2; ++i)
+        if (hybrid)
+            continue;
+
+        uint32 effect = spellInfo->Effects[0].Effect;
+        if (effect != SPELL_EFFECT_HEAL && effect != SPELL_EFFECT_ENERGIZE)
+            continue;
+
+        uint32 requiredLevel = proto->RequiredLevel;
+        for (uint32 level = std::max(requiredLevel, 1u); level <= maxLevel; level++)
         {
-            uint32 effect = effects[i];
-            uint32 size = potionCache[level][effect].size();
-            counter += size;
+            if (level > 13 && requiredLevel < level - 13)
+                break;
+
+            potionCache[level][effect].push_back(itr.first);
+            ++counter;
         }
     }
 
@@ -2422,40 +2374,39 @@ void RandomItemMgr::BuildFoodCache()
     LOG_INFO("server.loading", "Building food cache for {} levels", maxLevel);
 
     ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
-
     uint32 counter = 0;
-    for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+
+    // Items are checked once and then added to every level bracket they fit
+    for (auto const& itr : *itemTemplates)
     {
-        uint32 categories[] = {11, 59};
-        for (int i = 0; i < 2; ++i)
-        {
-            uint32 category = categories[i];
+        ItemTemplate const* proto = &itr.second;
+        if (!proto)
+            continue;
 
-            for (auto const& itr : *itemTemplates)
-            {
-                ItemTemplate const* proto = &itr.second;
-                if (!proto)
-                    continue;
+        uint32 category = proto->Spells[0].SpellCategory;
+        if (category != 11 && category != 59)
+            continue;
 
-                if (proto->Class != ITEM_CLASS_CONSUMABLE ||
-                    (proto->SubClass != ITEM_SUBCLASS_FOOD && proto->SubClass != ITEM_SUBCLASS_CONSUMABLE) ||
-                    (proto->Spells[0].SpellCategory != category) || proto->Bonding != NO_BIND)
-                    continue;
+        if (proto->Class != ITEM_CLASS_CONSUMABLE ||
+            (proto->SubClass != ITEM_SUBCLASS_FOOD && proto->SubClass != ITEM_SUBCLASS_CONSUMABLE) ||
+            proto->Bonding != NO_BIND)
+            continue;
 
-                if (proto->RequiredLevel && (proto->RequiredLevel > level || proto->RequiredLevel < level - 10))
-                    continue;
+        if (proto->RequiredSkill)
+            continue;
 
-                if (proto->RequiredSkill)
-                    continue;
+        if (proto->Area || proto->Map || proto->RequiredCityRank || proto->RequiredHonorRank)
+            continue;
 
-                if (proto->Area || proto->Map || proto->RequiredCityRank || proto->RequiredHonorRank)
-                    continue;
+        if (proto->Duration & 0x80000000)
+            continue;
 
-                if (proto->Duration & 0x80000000)
-                    continue;
+        for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+        {
+            if (proto->RequiredLevel && (proto->RequiredLevel > level || proto->RequiredLevel < level - 10))
+                continue;
 
-                foodCache[level / 10][category].push_back(itr.first);
-            }
+            foodCache[level / 10][category].push_back(itr.first);
         }
     }
 
@@ -2467,6 +2418,7 @@ void RandomItemMgr::BuildFoodCache()
             uint32 category = categories[i];
             uint32 size = foodCache[level / 10][category].size();
             ++counter;
+
             LOG_DEBUG("server.loading", "Food cache for level={}, category={}: {} items", level, category, size);
         }
     }
@@ -2555,28 +2507,29 @@ void RandomItemMgr::BuildTradeCache()
     LOG_INFO("server.loading", "Building trade cache for {} levels", maxLevel);
 
     ItemTemplateContainer const* itemTemplates = sObjectMgr->GetItemTemplateStore();
-
     uint32 counter = 0;
-    for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+
+    // Items are checked once and then added to every level bracket they fit
+    for (auto const& itr : *itemTemplates)
     {
-        for (auto const& itr : *itemTemplates)
-        {
-            ItemTemplate const* proto = &itr.second;
-            if (!proto)
-                continue;
+        ItemTemplate const* proto = &itr.second;
+        if (!proto)
+            continue;
 
-            if (proto->Class != ITEM_CLASS_TRADE_GOODS || proto->Bonding != NO_BIND)
-                continue;
+        if (proto->Class != ITEM_CLASS_TRADE_GOODS || proto->Bonding != NO_BIND)
+            continue;
+
+        if (proto->RequiredSkill)
+            continue;
 
+        for (uint32 level = 1; level <= maxLevel + 1; level += 10)
+        {
             if (proto->ItemLevel < level)
                 continue;
 
             if (proto->RequiredLevel && (proto->RequiredLevel > level || proto->RequiredLevel < level - 10))
                 continue;
 
-            if (proto->RequiredSkill)
-                continue;
-
             tradeCache[level / 10].push_back(itr.first);
         }
     }
@@ -2584,7 +2537,9 @@ void RandomItemMgr::BuildTradeCache()
     for (uint32 level = 1; level <= maxLevel + 1; level += 10)
     {
         uint32 size = tradeCache[level / 10].size();
+
         LOG_DEBUG("server.loading", "Trade cache for level={}: {} items", level, size);
+
         ++counter;
     }
 
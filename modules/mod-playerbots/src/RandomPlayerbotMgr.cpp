@@ -2170,6 +2170,8 @@ void RandomPlayerbotMgr::Init()
         sRandomPlayerbotMgr->LoadBattleMastersCache();
 
     PlayerbotsDatabase.Execute("DELETE FROM playerbots_random_bots WHERE event = 'add'");
+
+    LoadEventValues();
 }
 
 void RandomPlayerbotMgr::RandomTeleportForLevel(Player* bot)
@@ -2450,17 +2452,11 @@ void RandomPlayerbotMgr::RandomizeFirst(Player* bot)
     uint32 inworldTime =
         urand(sPlayerbotAIConfig->minRandomBotInWorldTime, sPlayerbotAIConfig->maxRandomBotInWorldTime);
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, randomTime);
-    stmt->SetData(1, "bot_delete");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
-    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, inworldTime);
-    stmt->SetData(1, "logout");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
+    // Go through the cache so the new timeouts are not lost to a later write behind
+    uint32 botId = bot->GetGUID().GetCounter();
+    SetEventValue(botId, "bot_delete", GetEventValue(botId, "bot_delete"), randomTime,
+                  GetEventData(botId, "bot_delete"));
+    SetEventValue(botId, "logout", GetEventValue(botId, "logout"), inworldTime, GetEventData(botId, "logout"));
 
     // teleport to a random inn for bot level
     botAI->Reset(true);
@@ -2491,17 +2487,11 @@ void RandomPlayerbotMgr::RandomizeMin(Player* bot)
     uint32 inworldTime =
         urand(sPlayerbotAIConfig->minRandomBotInWorldTime, sPlayerbotAIConfig->maxRandomBotInWorldTime);
 
-    PlayerbotsDatabasePreparedStatement* stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, randomTime);
-    stmt->SetData(1, "bot_delete");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
-
-    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_UPD_RANDOM_BOTS);
-    stmt->SetData(0, inworldTime);
-    stmt->SetData(1, "logout");
-    stmt->SetData(2, bot->GetGUID().GetCounter());
-    PlayerbotsDatabase.Execute(stmt);
+    // Go through the cache so the new timeouts are not lost to a later write behind
+    uint32 botId = bot->GetGUID().GetCounter();
+    SetEventValue(botId, "bot_delete", GetEventValue(botId, "bot_delete"), randomTime,
+                  GetEventData(botId, "bot_delete"));
+    SetEventValue(botId, "logout", GetEventValue(botId, "logout"), inworldTime, GetEventData(botId, "logout"));
 
     // teleport to a random inn for bot level
     botAI->Reset(true);
@@ -2672,6 +2662,8 @@ void RandomPlayerbotMgr::GetBots()
     if (!currentBots.empty())
         return;
 
+    FlushEventValues(true);
+
     PlayerbotsDatabasePreparedStatement* stmt =
         PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER_AND_EVENT);
     stmt->SetData(0, 0);
@@ -2698,6 +2690,8 @@ std::vector<uint32> RandomPlayerbotMgr::GetBgBots(uint32 bracket)
 
     std::vector<uint32> BgBots;
 
+    FlushEventValues(true);
+
     PlayerbotsDatabasePreparedStatement* stmt =
         PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BY_EVENT_AND_VALUE);
     stmt->SetData(0, "bg");
@@ -2719,8 +2713,8 @@ CachedEvent* RandomPlayerbotMgr::FindEvent(uint32 bot, std::string const& event)
 {
     BotEventCache& cache = eventCache[bot];
 
-    // Load once
-    if (!cache.loaded)
+    // Load once, unless every bot was loaded at startup
+    if (!cache.loaded && !eventCacheLoaded)
     {
         cache.events.clear();
 
@@ -2766,6 +2760,8 @@ CachedEvent* RandomPlayerbotMgr::FindEvent(uint32 bot, std::string const& event)
 
 uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, std::string const& event)
 {
+    std::lock_guard<std::mutex> guard(eventCacheLock);
+
     if (CachedEvent* e = FindEvent(bot, event))
         return e->value;
 
@@ -2774,17 +2770,17 @@ uint32 RandomPlayerbotMgr::GetEventValue(uint32 bot, std::string const& event)
 
 std::string RandomPlayerbotMgr::GetEventData(uint32 bot, std::string const& event)
 {
+    std::lock_guard<std::mutex> guard(eventCacheLock);
+
     if (CachedEvent* e = FindEvent(bot, event))
         return e->data;
 
     return "";
 }
 
-uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, std::string const& event, uint32 value, uint32 validIn,
-                                         std::string const& data)
+static void AppendEventValue(PlayerbotsDatabaseTransaction trans, uint32 bot, std::string const& event,
+                             CachedEvent const* e)
 {
-    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
-
     PlayerbotsDatabasePreparedStatement* stmt =
         PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS_BY_OWNER_AND_EVENT);
     stmt->SetData(0, 0);
@@ -2792,45 +2788,146 @@ uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, std::string const& event, u
     stmt->SetData(2, event.c_str());
     trans->Append(stmt);
 
-    if (value)
-    {
-        stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_RANDOM_BOTS);
-        stmt->SetData(0, 0);
-        stmt->SetData(1, bot);
-        stmt->SetData(2, NowSeconds());
-        stmt->SetData(3, validIn);
-        stmt->SetData(4, event.c_str());
-        stmt->SetData(5, value);
+    if (!e)
+        return;
 
-        if (!data.empty())
-            stmt->SetData(6, data.c_str());
-        else
-            stmt->SetData(6);  // NULL
+    stmt = PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_INS_RANDOM_BOTS);
+    stmt->SetData(0, 0);
+    stmt->SetData(1, bot);
+    stmt->SetData(2, e->lastChangeTime);
+    stmt->SetData(3, e->validIn);
+    stmt->SetData(4, event.c_str());
+    stmt->SetData(5, e->value);
 
-        trans->Append(stmt);
-    }
+    if (!e->data.empty())
+        stmt->SetData(6, e->data.c_str());
+    else
+        stmt->SetData(6);  // NULL
 
-    PlayerbotsDatabase.CommitTransaction(trans);
+    trans->Append(stmt);
+}
+
+uint32 RandomPlayerbotMgr::SetEventValue(uint32 bot, std::string const& event, uint32 value, uint32 validIn,
+                                         std::string const& data)
+{
+    std::lock_guard<std::mutex> guard(eventCacheLock);
 
     // Update in-memory cache
     BotEventCache& cache = eventCache[bot];
     cache.loaded = true;
 
-    if (!value)
+    CachedEvent* e = nullptr;
+    if (value)
     {
+        e = &cache.events[event];  // create-on-write is OK here
+        e->value = value;
+        e->lastChangeTime = NowSeconds();
+        e->validIn = validIn;
+        e->data = data;
+    }
+    else
         cache.events.erase(event);
-        return 0;
+
+    // The database is written behind in batches, unless that is disabled
+    if (sPlayerbotAIConfig->randomBotEventFlushInterval)
+    {
+        dirtyEvents.emplace(bot, event);
+        return value;
     }
 
-    CachedEvent& e = cache.events[event];  // create-on-write is OK here
-    e.value = value;
-    e.lastChangeTime = NowSeconds();
-    e.validIn = validIn;
-    e.data = data;
+    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
+    AppendEventValue(trans, bot, event, e);
+    PlayerbotsDatabase.CommitTransaction(trans);
 
     return value;
 }
 
+void RandomPlayerbotMgr::LoadEventValues()
+{
+    uint32 oldMSTime = getMSTime();
+    uint32 count = 0;
+
+    std::lock_guard<std::mutex> guard(eventCacheLock);
+
+    eventCache.clear();
+    dirtyEvents.clear();
+
+    PlayerbotsDatabasePreparedStatement* stmt =
+        PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_SEL_RANDOM_BOTS_BY_OWNER);
+    stmt->SetData(0, 0);
+
+    if (PreparedQueryResult result = PlayerbotsDatabase.Query(stmt))
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+
+            // "add" rows are being deleted by Init
+            std::string event = fields[1].Get<std::string>();
+            if (event == "add")
+                continue;
+
+            CachedEvent e;
+            e.value = fields[2].Get<uint32>();
+            e.lastChangeTime = fields[3].Get<uint32>();
+            e.validIn = fields[4].Get<uint32>();
+            e.data = fields[5].Get<std::string>();
+
+            BotEventCache& cache = eventCache[fields[0].Get<uint32>()];
+            cache.loaded = true;
+            cache.events.insert_or_assign(std::move(event), std::move(e));
+            ++count;
+        } while (result->NextRow());
+    }
+
+    eventCacheLoaded = true;
+
+    LOG_INFO("playerbots", ">> Loaded {} random bot event values in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
+}
+
+void RandomPlayerbotMgr::FlushEventValues(bool direct)
+{
+    std::lock_guard<std::mutex> guard(eventCacheLock);
+
+    if (dirtyEvents.empty())
+        return;
+
+    PlayerbotsDatabaseTransaction trans = PlayerbotsDatabase.BeginTransaction();
+
+    for (auto const& [bot, event] : dirtyEvents)
+    {
+        CachedEvent const* e = nullptr;
+
+        auto cache = eventCache.find(bot);
+        if (cache != eventCache.end())
+        {
+            auto it = cache->second.events.find(event);
+            if (it != cache->second.events.end())
+                e = &it->second;
+        }
+
+        AppendEventValue(trans, bot, event, e);
+    }
+
+    dirtyEvents.clear();
+
+    if (direct)
+        PlayerbotsDatabase.DirectCommitTransaction(trans);
+    else
+        PlayerbotsDatabase.CommitTransaction(trans);
+}
+
+void RandomPlayerbotMgr::UpdateEventValues(uint32 diff)
+{
+    eventFlushTimer += diff;
+
+    if (eventFlushTimer < sPlayerbotAIConfig->randomBotEventFlushInterval * IN_MILLISECONDS)
+        return;
+
+    eventFlushTimer = 0;
+    FlushEventValues();
+}
+
 uint32 RandomPlayerbotMgr::GetValue(uint32 bot, std::string const& type) { return GetEventValue(bot, type); }
 
 uint32 RandomPlayerbotMgr::GetValue(Player* bot, std::string const& type)
@@ -2869,7 +2966,9 @@ bool RandomPlayerbotMgr::HandlePlayerbotConsoleCommand(ChatHandler* handler, cha
     if (cmd == "reset")
     {
         PlayerbotsDatabase.Execute(PlayerbotsDatabase.GetPreparedStatement(PLAYERBOTS_DEL_RANDOM_BOTS));
+        std::lock_guard<std::mutex> guard(sRandomPlayerbotMgr->eventCacheLock);
         sRandomPlayerbotMgr->eventCache.clear();
+        sRandomPlayerbotMgr->dirtyEvents.clear();
         LOG_INFO("playerbots", "Random bots were reset for all players. Please restart the Server.");
         return true;
     }
@@ -3517,7 +3616,11 @@ void RandomPlayerbotMgr::Remove(Player* bot)
     PlayerbotsDatabase.Execute(stmt);
 
     uint32 botId = owner.GetCounter();
-    eventCache.erase(botId);
+    {
+        std::lock_guard<std::mutex> guard(eventCacheLock);
+        eventCache.erase(botId);
+        dirtyEvents.erase(dirtyEvents.lower_bound({botId, ""}), dirtyEvents.lower_bound({botId + 1, ""}));
+    }
 
     LogoutPlayerBot(owner);
 }
@@ -6,6 +6,9 @@
 #ifndef _PLAYERBOT_RANDOMPLAYERBOTMGR_H
 #define _PLAYERBOT_RANDOMPLAYERBOTMGR_H
 
+#include <mutex>
+#include <set>
+
 #include "NewRpgInfo.h"
 #include "ObjectGuid.h"
 #include "PlayerbotMgr.h"
@@ -167,6 +170,11 @@ public:
     void PrepareZone2LevelBracket();
     void PrepareTeleportCache();
     void Init();
+    void LoadEventValues();
+    // Writes the event values changed since the last flush in one transaction, direct waits for it so queries
+    // that follow see the rows
+    void FlushEventValues(bool direct = false);
+    void UpdateEventValues(uint32 diff);
     std::map<uint8, std::unordered_set<ObjectGuid>> addclassCache;
     std::map<uint8, std::vector<WorldLocation>> locsPerLevelCache;
     std::map<uint8, std::vector<WorldLocation>> allianceStarterPerLevelCache;
@@ -226,6 +234,10 @@ private:
     std::map<uint32, std::map<uint32, std::vector<WorldLocation>>> rpgLocsCacheLevel;
     std::map<TeamId, std::map<BattlegroundTypeId, std::vector<uint32>>> BattleMastersCache;
     std::unordered_map<uint32, BotEventCache> eventCache;
+    std::set<std::pair<uint32, std::string>> dirtyEvents;
+    std::mutex eventCacheLock;
+    bool eventCacheLoaded = false;
+    uint32 eventFlushTimer = 0;
     std::list<uint32> currentBots;
     uint32 bgBotsCount;
     uint32 playersLevel;
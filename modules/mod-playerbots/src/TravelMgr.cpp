@@ -1039,8 +1039,20 @@ std::vector<WorldPosition*> TravelDestination::getPoints(bool ignoreFull)
 
 WorldPosition* TravelDestination::nearestPoint(WorldPosition* pos)
 {
-    return *std::min_element(points.begin(), points.end(),
-                             [pos](WorldPosition* i, WorldPosition* j) { return i->distance(pos) < j->distance(pos); });
+    WorldPosition* nearest = points.front();
+    float nearestDistance = nearest->distance(pos);
+
+    for (auto point = std::next(points.begin()); point != points.end(); ++point)
+    {
+        float distance = (*point)->distance(pos);
+        if (distance < nearestDistance)
+        {
+            nearest = *point;
+            nearestDistance = distance;
+        }
+    }
+
+    return nearest;
 }
 
 std::vector<WorldPosition*> TravelDestination::touchingPoints(WorldPosition* pos)
@@ -1669,6 +1681,60 @@ TravelState TravelTarget::getTravelState()
     return TRAVEL_STATE_IDLE;
 }
 
+void TravelDestinationIndex::Clear() { maps.clear(); }
+
+void TravelDestinationIndex::Insert(uint32 index, WorldPosition* point)
+{
+    MapBucket& bucket = maps[point->getMapId()];
+
+    std::vector<uint32>& cell = bucket.cells[GetCellKey(GetCell(point->getX()), GetCell(point->getY()))];
+    if (cell.empty() || cell.back() != index)
+        cell.push_back(index);
+
+    if (bucket.destinations.empty() || bucket.destinations.back() != index)
+        bucket.destinations.push_back(index);
+}
+
+void TravelDestinationIndex::Query(WorldPosition* center, float maxDistance, float crossMapDistance,
+                                   std::vector<uint32>& indices) const
+{
+    for (auto const& [mapId, bucket] : maps)
+    {
+        if (mapId != center->getMapId())
+        {
+            if (crossMapDistance <= maxDistance)
+                indices.insert(indices.end(), bucket.destinations.begin(), bucket.destinations.end());
+
+            continue;
+        }
+
+        int32 minX = GetCell(center->getX() - maxDistance);
+        int32 maxX = GetCell(center->getX() + maxDistance);
+        int32 minY = GetCell(center->getY() - maxDistance);
+        int32 maxY = GetCell(center->getY() + maxDistance);
+
+        // A search area covering more cells than the map has filled ones is cheaper to take whole.
+        if (uint64(maxX - minX + 1) * uint64(maxY - minY + 1) >= bucket.cells.size())
+        {
+            indices.insert(indices.end(), bucket.destinations.begin(), bucket.destinations.end());
+            continue;
+        }
+
+        for (int32 x = minX; x <= maxX; ++x)
+        {
+            for (int32 y = minY; y <= maxY; ++y)
+            {
+                auto cell = bucket.cells.find(GetCellKey(x, y));
+                if (cell != bucket.cells.end())
+                    indices.insert(indices.end(), cell->second.begin(), cell->second.end());
+            }
+        }
+    }
+
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+}
+
 void TravelMgr::Clear()
 {
     std::shared_lock<std::shared_mutex> lock(*HashMapHolder<Player>::GetLock());
@@ -1696,6 +1762,31 @@ void TravelMgr::Clear()
 
     questGivers.clear();
     quests.clear();
+
+    // these hold pointers into travelPoints, so they go before the points do
+    for (auto& dest : rpgNpcs)
+        delete dest;
+
+    for (auto& dest : grindMobs)
+        delete dest;
+
+    for (auto& dest : bossMobs)
+        delete dest;
+
+    for (auto& dest : exploreLocs)
+        delete dest.second;
+
+    rpgNpcs.clear();
+    grindMobs.clear();
+    bossMobs.clear();
+    exploreLocs.clear();
+
+    questGiverIndex.Clear();
+    rpgNpcIndex.Clear();
+    grindMobIndex.Clear();
+    bossMobIndex.Clear();
+
+    travelPoints.clear();
 }
 
 void TravelMgr::logQuestError(uint32 errorNr, Quest* quest, uint32 objective, uint32 unitId, uint32 itemId)
@@ -2020,10 +2111,10 @@ void TravelMgr::LoadQuestTravelTable()
 
                     for (auto& guidP : e.second)
                     {
-                        WorldPosition point = guidP;
+                        WorldPosition* point = &travelPoints.emplace_back(guidP);
                         for (auto tLoc : locs)
                         {
-                            tLoc->addPoint(&point);
+                            tLoc->addPoint(point);
                         }
                     }
                 }
@@ -2243,7 +2334,7 @@ void TravelMgr::LoadQuestTravelTable()
                 rLoc->setExpireDelay(5 * 60 * 1000);
                 rLoc->setMaxVisitors(15, 0);
 
-                rLoc->addPoint(&point);
+                rLoc->addPoint(&travelPoints.emplace_back(point));
                 rpgNpcs.push_back(rLoc);
                 break;
             }
@@ -2257,7 +2348,7 @@ void TravelMgr::LoadQuestTravelTable()
             gLoc->setMaxVisitors(100, 0);
 
             point = WorldPosition(u.map, u.x, u.y, u.z, u.o);
-            gLoc->addPoint(&point);
+            gLoc->addPoint(&travelPoints.emplace_back(point));
             grindMobs.push_back(gLoc);
         }
 
@@ -2270,7 +2361,7 @@ void TravelMgr::LoadQuestTravelTable()
             bLoc->setExpireDelay(5 * 60 * 1000);
             bLoc->setMaxVisitors(0, 0);
 
-            bLoc->addPoint(&point);
+            bLoc->addPoint(&travelPoints.emplace_back(point));
             bossMobs.push_back(bLoc);
         }
     }
@@ -2311,9 +2402,14 @@ void TravelMgr::LoadQuestTravelTable()
             loc = iloc->second;
         }
 
-        loc->addPoint(&point);
+        loc->addPoint(&travelPoints.emplace_back(point));
     }
 
+    questGiverIndex.Build(questGivers);
+    rpgNpcIndex.Build(rpgNpcs);
+    grindMobIndex.Build(grindMobs);
+    bossMobIndex.Build(bossMobs);
+
     // Clear these logs files
     sPlayerbotAIConfig->openLog("zones.csv", "w");
     sPlayerbotAIConfig->openLog("creatures.csv", "w");
@@ -3924,7 +4020,7 @@ std::vector<TravelDestination*> TravelMgr::getQuestTravelDestinations(Player* bo
 
     if (!questId)
     {
-        for (auto& dest : questGivers)
+        for (auto& dest : getNearbyDestinations(questGiverIndex, questGivers, &botLocation, maxDistance))
         {
             if (!ignoreInactive && !dest->isActive(bot))
                 continue;
@@ -3962,7 +4058,7 @@ std::vector<TravelDestination*> TravelMgr::getQuestTravelDestinations(Player* bo
     }
     else if (questId == -1)
     {
-        for (auto& dest : questGivers)
+        for (auto& dest : getNearbyDestinations(questGiverIndex, questGivers, &botLocation, maxDistance))
         {
             if (!ignoreInactive && !dest->isActive(bot))
                 continue;
@@ -4023,7 +4119,7 @@ std::vector<TravelDestination*> TravelMgr::getRpgTravelDestinations(Player* bot,
 
     std::vector<TravelDestination*> retTravelLocations;
 
-    for (auto& dest : rpgNpcs)
+    for (auto& dest : getNearbyDestinations(rpgNpcIndex, rpgNpcs, &botLocation, maxDistance))
     {
         if (!ignoreInactive && !dest->isActive(bot))
             continue;
@@ -4068,7 +4164,7 @@ std::vector<TravelDestination*> TravelMgr::getGrindTravelDestinations(Player* bo
 
     std::vector<TravelDestination*> retTravelLocations;
 
-    for (auto& dest : grindMobs)
+    for (auto& dest : getNearbyDestinations(grindMobIndex, grindMobs, &botLocation, maxDistance))
     {
         if (!ignoreInactive && !dest->isActive(bot))
             continue;
@@ -4180,6 +4276,28 @@ float TravelMgr::mapTransDistance(WorldPosition start, WorldPosition end)
     return minDist;
 }
 
+// Lower bound of the distance from any other map to pos, every way in ends at a transfer point on its map.
+float TravelMgr::minMapTransDistance(WorldPosition* pos)
+{
+    float minDist = 200000;
+
+    for (auto& mapTransfers : mapTransfersMap)
+    {
+        if (mapTransfers.first.second != pos->getMapId())
+            continue;
+
+        for (auto& mapTrans : mapTransfers.second)
+        {
+            float dist = mapTrans.getPointTo()->distance(pos);
+
+            if (dist < minDist)
+                minDist = dist;
+        }
+    }
+
+    return minDist;
+}
+
 float TravelMgr::fastMapTransDistance(WorldPosition start, WorldPosition end)
 {
     uint32 sMap = start.getMapId();
@@ -7,6 +7,7 @@
 #define _PLAYERBOT_TRAVELMGR_H
 
 #include <boost/functional/hash.hpp>
+#include <deque>
 #include <random>
 
 #include "AiObject.h"
@@ -844,6 +845,41 @@ protected:
     WorldPosition* wPosition = nullptr;
 };
 
+// Buckets a list of travel destinations by map and grid so distance limited lookups only visit nearby entries.
+class TravelDestinationIndex
+{
+public:
+    template <class T>
+    void Build(std::vector<T*> const& destinations)
+    {
+        Clear();
+
+        for (uint32 i = 0; i < destinations.size(); ++i)
+            for (WorldPosition* point : destinations[i]->getPoints(true))
+                Insert(i, point);
+    }
+
+    void Clear();
+
+    // Fills indices (in list order) with every destination that can be within maxDistance of center.
+    // Destinations on other maps are only included when crossMapDistance, the shortest possible way in, is in range.
+    void Query(WorldPosition* center, float maxDistance, float crossMapDistance, std::vector<uint32>& indices) const;
+
+private:
+    struct MapBucket
+    {
+        std::unordered_map<uint32, std::vector<uint32>> cells;
+        std::vector<uint32> destinations;
+    };
+
+    static int32 GetCell(float coord) { return int32(std::floor(coord / SIZE_OF_GRIDS)); }
+    static uint32 GetCellKey(int32 x, int32 y) { return (uint32(uint16(x)) << 16) | uint16(y); }
+
+    void Insert(uint32 index, WorldPosition* point);
+
+    std::unordered_map<uint32, MapBucket> maps;
+};
+
 // General container for all travel destinations.
 class TravelMgr
 {
@@ -901,6 +937,26 @@ public:
     void loadMapTransfers();
     float mapTransDistance(WorldPosition start, WorldPosition end);
     float fastMapTransDistance(WorldPosition start, WorldPosition end);
+    float minMapTransDistance(WorldPosition* pos);
+
+    // Returns the destinations of the list that can be within maxDistance of center, in list order.
+    template <class T>
+    std::vector<T*> getNearbyDestinations(TravelDestinationIndex const& index, std::vector<T*> const& destinations,
+                                          WorldPosition* center, float maxDistance)
+    {
+        if (maxDistance <= 0)
+            return destinations;
+
+        std::vector<uint32> indices;
+        index.Query(center, maxDistance, minMapTransDistance(center), indices);
+
+        std::vector<T*> nearby;
+        nearby.reserve(indices.size());
+        for (uint32 i : indices)
+            nearby.push_back(destinations[i]);
+
+        return nearby;
+    }
 
     NullTravelDestination* nullTravelDestination = new NullTravelDestination();
     WorldPosition* nullWorldPosition = new WorldPosition();
@@ -932,6 +988,14 @@ public:
     std::vector<GrindTravelDestination*> grindMobs;
     std::vector<BossTravelDestination*> bossMobs;
 
+    TravelDestinationIndex questGiverIndex;
+    TravelDestinationIndex rpgNpcIndex;
+    TravelDestinationIndex grindMobIndex;
+    TravelDestinationIndex bossMobIndex;
+
+    // Owns the positions the loaded destinations point to.
+    std::deque<WorldPosition> travelPoints;
+
     std::unordered_map<uint32, ExploreTravelDestination*> exploreLocs;
     std::unordered_map<uint32, QuestContainer*> quests;
 
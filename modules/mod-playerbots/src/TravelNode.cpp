@@ -1193,7 +1193,40 @@ TravelNode* TravelNodeMap::getNode(WorldPosition pos, [[maybe_unused]] std::vect
     return nullptr;
 }
 
+// A* state kept between the searches of one thread, cleared maps and vectors keep their storage.
+struct TravelNodeSearchArena
+{
+    std::unordered_map<TravelNode*, TravelNodeStub> stubs;
+    std::vector<std::pair<float, TravelNodeStub*>> open;
+    bool inUse = false;
+};
+
+// Money the bot can spend on travel, the budget of the flight paths in a route.
+static uint32 GetTravelGold(Player* bot)
+{
+    if (!bot)
+        return 0;
+
+    PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
+    if (!botAI)
+        return bot->GetMoney();
+
+    if (botAI->HasCheat(BotCheatMask::gold))
+        return 10000000;
+
+    AiObjectContext* context = botAI->GetAiObjectContext();
+    return AI_VALUE2(uint32, "free money for", (uint32)NeedMoneyFor::travel);
+}
+
 TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Player* bot)
+{
+    if (start == goal)
+        return TravelNodeRoute();
+
+    return getRoute(start, goal, bot, GetTravelGold(bot));
+}
+
+TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Player* bot, uint32 startGold)
 {
     float botSpeed = bot ? bot->GetSpeed(MOVE_RUN) : 7.0f;
 
@@ -1201,7 +1234,25 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
         return TravelNodeRoute();
 
     // Basic A* algoritm
-    std::unordered_map<TravelNode*, TravelNodeStub> m_stubs;
+    thread_local TravelNodeSearchArena threadArena;
+    TravelNodeSearchArena localArena;
+    TravelNodeSearchArena& arena = threadArena.inUse ? localArena : threadArena;
+    arena.inUse = true;
+    arena.stubs.clear();
+    arena.open.clear();
+
+    std::unordered_map<TravelNode*, TravelNodeStub>& m_stubs = arena.stubs;
+
+    // Min-heap on f. Nodes whose cost improves are pushed again, the outdated entries are skipped when popped.
+    std::vector<std::pair<float, TravelNodeStub*>>& open = arena.open;
+    auto heapCompare = [](std::pair<float, TravelNodeStub*> const& i, std::pair<float, TravelNodeStub*> const& j)
+    { return i.first > j.first; };
+    auto pushOpen = [&open, &heapCompare](TravelNodeStub* stub)
+    {
+        open.emplace_back(stub->m_f, stub);
+        std::push_heap(open.begin(), open.end(), heapCompare);
+        stub->open = true;
+    };
 
     TravelNodeStub* startStub = &m_stubs.insert(std::make_pair(start, TravelNodeStub(start))).first->second;
 
@@ -1211,23 +1262,11 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
     float g = 0.f;
     float h = 0.f;
 
-    std::vector<TravelNodeStub*> open, closed;
+    startStub->currentGold = startGold;
 
     if (bot)
     {
         PlayerbotAI* botAI = GET_PLAYERBOT_AI(bot);
-        if (botAI)
-        {
-            if (botAI->HasCheat(BotCheatMask::gold))
-                startStub->currentGold = 10000000;
-            else
-            {
-                AiObjectContext* context = botAI->GetAiObjectContext();
-                startStub->currentGold = AI_VALUE2(uint32, "free money for", (uint32)NeedMoneyFor::travel);
-            }
-        }
-        else
-            startStub->currentGold = bot->GetMoney();
 
         if (!bot->HasSpellCooldown(8690) && bot->IsAlive())
         {
@@ -1252,35 +1291,31 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
                 childNode->m_f = childNode->m_g + childNode->m_h;
                 // childNode->parent = startStub;
 
-                open.push_back(childNode);
-                std::push_heap(open.begin(), open.end(),
-                               [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-                childNode->open = true;
+                pushOpen(childNode);
             }
         }
     }
 
     if (open.size() == 0 && !start->hasRouteTo(goal))
+    {
+        arena.inUse = false;
         return TravelNodeRoute();
+    }
 
-    std::make_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-
-    open.push_back(startStub);
-    std::push_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-    startStub->open = true;
+    pushOpen(startStub);
 
     while (!open.empty())
     {
-        std::sort(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
+        std::pop_heap(open.begin(), open.end(), heapCompare);  // pop n node from open for which f is minimal
+        std::pair<float, TravelNodeStub*> top = open.back();
+        open.pop_back();
 
-        currentNode = open.front();  // pop n node from open for which f is minimal
+        currentNode = top.second;
+        if (!currentNode->open || top.first != currentNode->m_f)
+            continue;
 
-        std::pop_heap(open.begin(), open.end(), [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-        open.pop_back();
         currentNode->open = false;
-
         currentNode->close = true;
-        closed.push_back(currentNode);
 
         if (currentNode->dataNode == goal ||
             (currentNode->dataNode->getMapId() != start->getMapId() && currentNode->dataNode->isWalking()))
@@ -1298,6 +1333,7 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
 
             reverse(path.begin(), path.end());
 
+            arena.inUse = false;
             return TravelNodeRoute(path);
         }
 
@@ -1328,16 +1364,11 @@ TravelNodeRoute TravelNodeMap::getRoute(TravelNode* start, TravelNode* goal, Pla
             if (childNode->close)
                 childNode->close = false;
 
-            if (!childNode->open)
-            {
-                open.push_back(childNode);
-                std::push_heap(open.begin(), open.end(),
-                               [](TravelNodeStub* i, TravelNodeStub* j) { return i->m_f < j->m_f; });
-                childNode->open = true;
-            }
+            pushOpen(childNode);
         }
     }
 
+    arena.inUse = false;
     return TravelNodeRoute();
 }
 
@@ -1360,6 +1391,9 @@ TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition en
     std::partial_sort(endNodes.begin(), endNodes.begin() + 5, endNodes.end(),
                       [endPos](TravelNode* i, TravelNode* j) { return i->fDist(endPos) < j->fDist(endPos); });
 
+    // The money of the bot does not change between the combinations.
+    uint32 travelGold = GetTravelGold(bot);
+
     // Cycle over the combinations of these 5 nodes.
     uint32 startI = 0, endI = 0;
     while (startI < 5 && endI < 5)
@@ -1372,7 +1406,7 @@ TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition en
 
         float maxStartDistance = startNode->isTransport() ? 20.0f : sPlayerbotAIConfig->targetPosRecalcDistance;
 
-        TravelNodeRoute route = getRoute(startNode, endNode, bot);
+        TravelNodeRoute route = getRoute(startNode, endNode, bot, travelGold);
 
         if (!route.isEmpty())
         {
@@ -1415,7 +1449,7 @@ TravelNodeRoute TravelNodeMap::getRoute(WorldPosition startPos, WorldPosition en
         while (endI < 5)
         {
             TravelNode* endNode = endNodes[endI];
-            TravelNodeRoute route = getRoute(botNode, endNode, bot);
+            TravelNodeRoute route = getRoute(botNode, endNode, bot, travelGold);
 
             if (!route.isEmpty())
                 return route;
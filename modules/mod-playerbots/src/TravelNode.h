@@ -540,6 +540,7 @@ public:
 
     // Finds the best nodePath between two nodes
     TravelNodeRoute getRoute(TravelNode* start, TravelNode* goal, Player* bot = nullptr);
+    TravelNodeRoute getRoute(TravelNode* start, TravelNode* goal, Player* bot, uint32 startGold);
 
     // Find the best node between two positions
     TravelNodeRoute getRoute(WorldPosition startPos, WorldPosition endPos, std::vector<WorldPosition>& startPath,
@@ -92,6 +92,12 @@ public:
             return true;
         }
 
+        if (!strcmp(args, "flame"))
+        {
+            sPerformanceMonitor->WriteFlameGraph(sPlayerbotAIConfig->perfMonFlameGraphFile);
+            return true;
+        }
+
         if (!strcmp(args, "toggle"))
         {
             sPlayerbotAIConfig->perfMonEnabled = !sPlayerbotAIConfig->perfMonEnabled;
@@ -13,3 +13,11 @@ AiObject::AiObject(PlayerbotAI* botAI)
 }
 
 Player* AiObject::GetMaster() { return botAI->GetMaster(); }
+
+uint32 AiNamedObject::getPerfNameId()
+{
+    if (!perfNameId)
+        perfNameId = sPerformanceMonitor->RegisterName(getName());
+
+    return perfNameId;
+}
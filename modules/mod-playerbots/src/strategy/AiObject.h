@@ -33,9 +33,12 @@ public:
 
 public:
     virtual std::string const getName() { return name; }
+    // performance monitor id of the name, registered on first use
+    uint32 getPerfNameId();
 
 protected:
     std::string const name;
+    uint32 perfNameId = 0;
 };
 
 //
@@ -53,12 +53,29 @@ public:
         return GetValue<T>((std::string(name) + "::" + param));
     }
 
+    // AI_VALUE and friends pass string literals: those resolve through the interned handle
+    // of the literal without building a string
+    template <class T, std::size_t N>
+    Value<T>* GetValue(char const (&name)[N])
+    {
+        uint32 handle = NamedObjectHandles<UntypedValue>::FindLiteral(name);
+        if (handle == NamedObjectHandles<UntypedValue>::InvalidHandle)
+            return GetValue<T>(std::string(name));
+
+        return dynamic_cast<Value<T>*>(valueContexts.GetContextObject(handle, botAI));
+    }
+
+    // writable buffers may change their contents, so they always go through the name
+    template <class T, std::size_t N>
+    Value<T>* GetValue(char (&name)[N])
+    {
+        return GetValue<T>(std::string(name));
+    }
+
     template <class T>
     Value<T>* GetValue(std::string const name, int32 param)
     {
-        std::ostringstream out;
-        out << param;
-        return GetValue<T>(name, out.str());
+        return GetValue<T>(name, std::to_string(param));
     }
 
     std::set<std::string> GetValues();
@@ -69,7 +86,7 @@ public:
     std::vector<std::string> Save();
     void Load(std::vector<std::string> data);
 
-    std::vector<std::string> performanceStack;
+    PerformanceStack performanceStack;
 
     static void BuildAllSharedContexts();
 
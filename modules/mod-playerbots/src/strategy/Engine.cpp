@@ -123,7 +123,14 @@ void Engine::Init()
         Strategy* strategy = i->second;
         strategyTypeMask |= strategy->GetType();
         strategy->InitMultipliers(multipliers);
+
+        size_t first = triggers.size();
         strategy->InitTriggers(triggers);
+
+        uint32 strategyId = strategy->getPerfNameId();
+        for (size_t j = first; j < triggers.size(); ++j)
+            triggers[j]->setStrategyId(strategyId);
+
         for (auto &iter : strategy->actionNodeFactories.creators)
         {
             actionNodeFactories.creators[iter.first] = iter.second;
@@ -155,9 +162,18 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
 
     uint32 iterations = 0;
     uint32 iterationsPerTick = queue.Size() * (minimal ? 2 : sPlayerbotAIConfig->iterationsPerTick);
+    PerformanceMonitorOperation* strategyPmo = nullptr;
+    PerformanceMonitorOperation* triggerPmo = nullptr;
 
     while (++iterations <= iterationsPerTick)
     {
+        // frames of the previous action are closed here so every way out of the loop body is covered
+        if (triggerPmo)
+            triggerPmo->finish();
+        if (strategyPmo)
+            strategyPmo->finish();
+        triggerPmo = strategyPmo = nullptr;
+
         basket = queue.Peek();
         if (!basket)
             break;
@@ -170,6 +186,15 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
 
         Event event = basket->getEvent();
         ActionNode* actionNode = queue.Pop();  // NOTE: Pop() deletes basket
+
+        // the action and the values it reads are attributed to the strategy and trigger that queued it
+        if (event.getPerfStrategyId())
+        {
+            strategyPmo = sPerformanceMonitor->enter(PERF_MON_STRATEGY, event.getPerfStrategyId(),
+                                                     &aiObjectContext->performanceStack);
+            triggerPmo = sPerformanceMonitor->enter(PERF_MON_TRIGGER, event.getPerfTriggerId(),
+                                                    &aiObjectContext->performanceStack);
+        }
         Action* action = InitializeAction(actionNode);
 
         if (!action)
@@ -204,7 +229,7 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
                     }
                 }
 
-                PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(PERF_MON_ACTION, action->getName(), &aiObjectContext->performanceStack);
+                PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(PERF_MON_ACTION, action->getPerfNameId(), &aiObjectContext->performanceStack);
                 actionExecuted = ListenAndExecute(action, event);
                 if (pmo)
                     pmo->finish();
@@ -238,6 +263,11 @@ bool Engine::DoNextAction(Unit* unit, uint32 depth, bool minimal)
         delete actionNode;  // Always delete after processing the action node
     }
 
+    if (triggerPmo)
+        triggerPmo->finish();
+    if (strategyPmo)
+        strategyPmo->finish();
+
     if (time(nullptr) - currentTime > 1)
     {
         LogAction("Execution time exceeded 1 second");
@@ -456,11 +486,15 @@ void Engine::ProcessTriggers(bool minimal)
             if (minimal && node->getFirstRelevance() < 100)
                 continue;
 
+            PerformanceMonitorOperation* strategyPmo =
+                sPerformanceMonitor->enter(PERF_MON_STRATEGY, node->getStrategyId(), &aiObjectContext->performanceStack);
             PerformanceMonitorOperation* pmo =
-                sPerformanceMonitor->start(PERF_MON_TRIGGER, trigger->getName(), &aiObjectContext->performanceStack);
+                sPerformanceMonitor->start(PERF_MON_TRIGGER, trigger->getPerfNameId(), &aiObjectContext->performanceStack);
             Event event = trigger->Check();
             if (pmo)
                 pmo->finish();
+            if (strategyPmo)
+                strategyPmo->finish();
 
             if (!event)
                 continue;
@@ -477,7 +511,9 @@ void Engine::ProcessTriggers(bool minimal)
         if (fires.find(trigger) == fires.end())
             continue;
 
+        // every node keeps its own strategy, several strategies may handle the same trigger
         Event event = fires[trigger];
+        event.setPerfOrigin(node->getStrategyId(), trigger->getPerfNameId());
         MultiplyAndPush(node->getHandlers(), 0.0f, false, event, "trigger");
     }
 
@@ -14,7 +14,11 @@ class Player;
 class Event
 {
 public:
-    Event(Event const& other) : source(other.source), param(other.param), packet(other.packet), owner(other.owner) {}
+    Event(Event const& other)
+        : source(other.source), param(other.param), packet(other.packet), owner(other.owner),
+          perfStrategyId(other.perfStrategyId), perfTriggerId(other.perfTriggerId)
+    {
+    }
     Event() {}
     Event(std::string const source) : source(source) {}
     Event(std::string const source, std::string const param, Player* owner = nullptr)
@@ -33,6 +37,14 @@ public:
     WorldPacket& getPacket() { return packet; }
     ObjectGuid getObject();
     Player* getOwner() { return owner; }
+    // performance monitor name ids of the strategy and trigger the event fired for, 0 when it came from elsewhere
+    uint32 getPerfStrategyId() { return perfStrategyId; }
+    uint32 getPerfTriggerId() { return perfTriggerId; }
+    void setPerfOrigin(uint32 strategyId, uint32 triggerId)
+    {
+        perfStrategyId = strategyId;
+        perfTriggerId = triggerId;
+    }
     bool operator!() const { return source.empty(); }
 
 protected:
@@ -40,6 +52,8 @@ protected:
     std::string param;
     WorldPacket packet;
     Player* owner = nullptr;
+    uint32 perfStrategyId = 0;
+    uint32 perfTriggerId = 0;
 };
 
 #endif
@@ -6,8 +6,12 @@
 #ifndef _PLAYERBOT_NAMEDOBJECTCONEXT_H
 #define _PLAYERBOT_NAMEDOBJECTCONEXT_H
 
+#include <deque>
+#include <limits>
 #include <list>
+#include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -39,6 +43,103 @@ protected:
     std::string qualifier;
 };
 
+// Interns the registered object names of one kind into dense integer handles, so
+// per-bot lookups index a vector instead of hashing strings on every call.
+template <class T>
+class NamedObjectHandles
+{
+public:
+    static constexpr uint32 InvalidHandle = std::numeric_limits<uint32>::max();
+
+    static uint32 Intern(std::string const& name)
+    {
+        std::unique_lock<std::shared_mutex> lock(GetLock());
+        auto result = GetHandles().try_emplace(name, uint32(GetNames().size()));
+        if (result.second)
+            GetNames().push_back(name);
+
+        return result.first->second;
+    }
+
+    // handles never change once interned, so every thread remembers the ones it found and only takes
+    // the lock for names it has not looked up yet. A name without a creator yet may be registered
+    // later, so only real handles are remembered
+    static uint32 Find(std::string const& name)
+    {
+        thread_local std::unordered_map<std::string, uint32> foundHandles;
+        auto itr = foundHandles.find(name);
+        if (itr != foundHandles.end())
+            return itr->second;
+
+        uint32 handle = FindShared(name);
+        if (handle != InvalidHandle)
+            foundHandles.emplace(name, handle);
+
+        return handle;
+    }
+
+    // meant for string literals, remembered per thread by their address. Other const arrays bind to
+    // the same overloads and may reuse an address for another name, so the contents are compared too
+    static uint32 FindLiteral(char const* literal)
+    {
+        struct LiteralHandle
+        {
+            std::string Name;
+            uint32 Handle;
+        };
+
+        thread_local std::unordered_map<char const*, LiteralHandle> literalHandles;
+        auto itr = literalHandles.find(literal);
+        if (itr != literalHandles.end() && itr->second.Name == literal)
+            return itr->second.Handle;
+
+        uint32 handle = Find(literal);
+        if (handle != InvalidHandle)
+            literalHandles.insert_or_assign(literal, LiteralHandle{ literal, handle });
+
+        return handle;
+    }
+
+    static std::string const& GetName(uint32 handle)
+    {
+        std::shared_lock<std::shared_mutex> lock(GetLock());
+        return GetNames()[handle];
+    }
+
+    static uint32 GetCount()
+    {
+        std::shared_lock<std::shared_mutex> lock(GetLock());
+        return uint32(GetNames().size());
+    }
+
+private:
+    static uint32 FindShared(std::string const& name)
+    {
+        std::shared_lock<std::shared_mutex> lock(GetLock());
+        auto itr = GetHandles().find(name);
+        return itr != GetHandles().end() ? itr->second : InvalidHandle;
+    }
+
+    static std::unordered_map<std::string, uint32>& GetHandles()
+    {
+        static std::unordered_map<std::string, uint32> handles;
+        return handles;
+    }
+
+    // deque keeps the names returned by GetName in place while new names are interned
+    static std::deque<std::string>& GetNames()
+    {
+        static std::deque<std::string> names;
+        return names;
+    }
+
+    static std::shared_mutex& GetLock()
+    {
+        static std::shared_mutex lock;
+        return lock;
+    }
+};
+
 template <class T>
 class NamedObjectFactory
 {
@@ -149,7 +250,10 @@ public:
     {
         contexts.push_back(context);
         for (auto const& iter : context->creators)
+        {
             creators[iter.first] = iter.second;
+            NamedObjectHandles<T>::Intern(iter.first);
+        }
     }
 };
 
@@ -203,13 +307,27 @@ public:
 
     T* GetContextObject(const std::string& name, PlayerbotAI* botAI)
     {
-        if (created.find(name) == created.end())
-        {
-            if (T* object = create(name, botAI))
-                return created[name] = object;
-        }
+        // qualified names ("name::qualifier") are not interned, don't look them up
+        if (name.find("::") != std::string::npos)
+            return GetCreatedObject(name, botAI);
 
-        return created[name];
+        uint32 handle = NamedObjectHandles<T>::Find(name);
+        if (handle != NamedObjectHandles<T>::InvalidHandle)
+            return GetContextObject(handle, botAI);
+
+        return GetCreatedObject(name, botAI);
+    }
+
+    T* GetContextObject(uint32 handle, PlayerbotAI* botAI)
+    {
+        if (handle >= slots.size())
+            slots.resize(NamedObjectHandles<T>::GetCount(), nullptr);
+
+        T*& slot = slots[handle];
+        if (!slot)
+            slot = GetCreatedObject(NamedObjectHandles<T>::GetName(handle), botAI);
+
+        return slot;
     }
 
     std::set<std::string> GetSiblings(const std::string& name)
@@ -252,6 +370,21 @@ public:
 
         return result;
     }
+
+private:
+    T* GetCreatedObject(const std::string& name, PlayerbotAI* botAI)
+    {
+        auto itr = created.find(name);
+        if (itr != created.end())
+            return itr->second;
+
+        T* object = create(name, botAI);
+        created[name] = object;
+        return object;
+    }
+
+    // objects of interned names by handle, owned by created
+    std::vector<T*> slots;
 };
 
 template <class T>
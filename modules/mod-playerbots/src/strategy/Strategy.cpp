@@ -143,3 +143,11 @@ Strategy::Strategy(PlayerbotAI* botAI) : PlayerbotAIAware(botAI)
 }
 
 ActionNode* Strategy::GetAction(std::string const name) { return actionNodeFactories.GetContextObject(name, botAI); }
+
+uint32 Strategy::getPerfNameId()
+{
+    if (!perfNameId)
+        perfNameId = sPerformanceMonitor->RegisterName(getName());
+
+    return perfNameId;
+}
@@ -68,9 +68,14 @@ public:
     virtual ActionNode* GetAction(std::string const name);
     void Update() {}
     void Reset() {}
+    // performance monitor id of the name, registered on first use
+    uint32 getPerfNameId();
 
 public:
     NamedObjectFactoryList<ActionNode> actionNodeFactories;
+
+private:
+    uint32 perfNameId = 0;
 };
 
 #endif
@@ -55,6 +55,9 @@ public:
     Trigger* getTrigger() { return trigger; }
     void setTrigger(Trigger* trigger) { this->trigger = trigger; }
     const std::string getName() { return name; }
+    // performance monitor name id of the strategy that added the node
+    uint32 getStrategyId() { return strategyId; }
+    void setStrategyId(uint32 strategyId) { this->strategyId = strategyId; }
 
     std::vector<NextAction> getHandlers()
     {
@@ -81,4 +84,5 @@ private:
     Trigger* trigger;
     std::vector<NextAction> handlers;
     const std::string name;
+    uint32 strategyId = 0;
 };
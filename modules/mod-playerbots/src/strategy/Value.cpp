@@ -124,7 +124,7 @@ Unit* UnitCalculatedValue::Get()
     if (checkInterval < 2)
     {
         PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(
-            PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
+            PERF_MON_VALUE, this->getPerfNameId(), this->context ? &this->context->performanceStack : nullptr);
         value = Calculate();
         if (pmo)
             pmo->finish();
@@ -136,7 +136,7 @@ Unit* UnitCalculatedValue::Get()
         {
             lastCheckTime = now;
             PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(
-                PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
+                PERF_MON_VALUE, this->getPerfNameId(), this->context ? &this->context->performanceStack : nullptr);
             value = Calculate();
             if (pmo)
                 pmo->finish();
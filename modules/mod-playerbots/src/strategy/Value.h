@@ -155,7 +155,7 @@ public:
             this->lastCheckTime = now;
 
             PerformanceMonitorOperation* pmo = sPerformanceMonitor->start(
-                PERF_MON_VALUE, this->getName(), this->context ? &this->context->performanceStack : nullptr);
+                PERF_MON_VALUE, this->getPerfNameId(), this->context ? &this->context->performanceStack : nullptr);
             this->value = this->Calculate();
             if (pmo)
                 pmo->finish();
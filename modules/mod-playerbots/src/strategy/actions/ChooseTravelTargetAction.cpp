@@ -794,7 +794,7 @@ std::vector<TravelDestination*> TravelMgr::getBossTravelDestinations(Player* bot
 
     std::vector<TravelDestination*> retTravelLocations;
 
-    for (auto& dest : bossMobs)
+    for (auto& dest : getNearbyDestinations(bossMobIndex, bossMobs, &botLocation, maxDistance))
     {
         if (!ignoreInactive && !dest->isActive(bot))
             continue;
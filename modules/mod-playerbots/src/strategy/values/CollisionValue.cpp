@@ -8,6 +8,7 @@
 #include "CellImpl.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "PlayerbotPerception.h"
 #include "Playerbots.h"
 #include "ServerFacade.h"
 
@@ -20,8 +21,7 @@ bool CollisionValue::Calculate()
     std::list<Unit*> targets;
     float range = sPlayerbotAIConfig->contactDistance;
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    sPlayerbotPerception->FindUnits(bot, range, u_check, targets);
 
     for (Unit* target : targets)
     {
@@ -8,6 +8,7 @@
 #include "CellImpl.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "PlayerbotPerception.h"
 #include "Playerbots.h"
 
 class AnyDeadUnitInObjectRangeCheck
@@ -15,7 +16,7 @@ class AnyDeadUnitInObjectRangeCheck
 public:
     AnyDeadUnitInObjectRangeCheck(WorldObject const* obj, float range) : i_obj(obj), i_range(range) {}
     WorldObject const& GetFocusObject() const { return *i_obj; }
-    bool operator()(Unit* u) { return !u->IsAlive(); }
+    bool operator()(Unit* u) { return !u->IsAlive() && i_obj->IsWithinDistInMap(u, i_range); }
 
 private:
     WorldObject const* i_obj;
@@ -25,8 +26,7 @@ private:
 void NearestCorpsesValue::FindUnits(std::list<Unit*>& targets)
 {
     AnyDeadUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<AnyDeadUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    sPlayerbotPerception->FindUnits(bot, range, u_check, targets);
 }
 
 bool NearestCorpsesValue::AcceptUnit(Unit* unit) { return true; }
@@ -8,13 +8,13 @@
 #include "CellImpl.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "PlayerbotPerception.h"
 #include "Playerbots.h"
 
 void NearestFriendlyPlayersValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyFriendlyUnitInObjectRangeCheck u_check(bot, bot, range);
-    Acore::UnitListSearcher<Acore::AnyFriendlyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    sPlayerbotPerception->FindUnits(bot, range, u_check, targets);
 }
 
 bool NearestFriendlyPlayersValue::AcceptUnit(Unit* unit)
@@ -8,6 +8,7 @@
 #include "CellImpl.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "PlayerbotPerception.h"
 #include "Playerbots.h"
 #include "SharedDefines.h"
 #include "SpellMgr.h"
@@ -16,8 +17,7 @@ GuidVector NearestGameObjects::Calculate()
 {
     std::list<GameObject*> targets;
     AnyGameObjectInObjectRangeCheck u_check(bot, range);
-    Acore::GameObjectListSearcher<AnyGameObjectInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    sPlayerbotPerception->FindGameObjects(bot, range, u_check, targets);
 
     GuidVector result;
     for (GameObject* go : targets)
@@ -33,8 +33,7 @@ GuidVector NearestTrapWithDamageValue::Calculate()
 {
     std::list<GameObject*> targets;
     AnyGameObjectInObjectRangeCheck u_check(bot, range);
-    Acore::GameObjectListSearcher<AnyGameObjectInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    sPlayerbotPerception->FindGameObjects(bot, range, u_check, targets);
 
     GuidVector result;
     for (GameObject* go : targets)
@@ -8,13 +8,13 @@
 #include "CellImpl.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "PlayerbotPerception.h"
 #include "Playerbots.h"
 
 void NearestNonBotPlayersValue::FindUnits(std::list<Unit*>& targets)
 {
     Acore::AnyUnitInObjectRangeCheck u_check(bot, range);
-    Acore::UnitListSearcher<Acore::AnyUnitInObjectRangeCheck> searcher(bot, targets, u_check);
-    Cell::VisitObjects(bot, searcher, range);
+    sPlayerbotPerception->FindUnits(bot, range, u_check, targets);
 }
 
 bool NearestNonBotPlayersValue::AcceptUnit(Unit* unit)
@@ -17,6 +17,9 @@
 
 #include "EventProcessor.h"
 #include "Errors.h"
+#include <algorithm>
+#include <bit>
+#include <limits>
 
 void BasicEvent::ScheduleAbort()
 {
@@ -43,13 +46,8 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (BasicEvent* event = PopNextEvent())
     {
-        // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
-
         if (event->IsRunning())
         {
             if (event->Execute(m_time, p_time))
@@ -81,55 +79,40 @@ void EventProcessor::Update(uint32 p_time)
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    // detach everything first, Abort() handlers may add new events
+    for (BasicEvent* event : DetachEvents([](BasicEvent const*) { return true; }))
     {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
-        // Skip non-deletable events when we are
+        // Keep non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
+        if (!force && !event->IsDeletable())
         {
-            ++itr;
+            ScheduleEvent(event);
             continue;
         }
 
-        delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
+        delete event;
     }
-
-    if (force)
-        m_events.clear();
 }
 
 void EventProcessor::CancelEventGroup(uint8 group)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    for (BasicEvent* event : DetachEvents([group](BasicEvent const* event) { return event->m_eventGroup == group; }))
     {
-        if (itr->second->m_eventGroup != group)
-        {
-            ++itr;
-            continue;
-        }
-
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
-        delete itr->second;
-        itr = m_events.erase(itr);
+        delete event;
     }
 }
 
@@ -139,21 +122,17 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
     Event->m_eventGroup = eventGroup;
-    m_events.emplace(e_time, Event);
+    ScheduleEvent(Event);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    if (!event->m_queue)
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.emplace(newTime.count(), event);
-        break;
-    }
+    UnlinkEvent(event);
+    event->m_execTime = newTime.count();
+    ScheduleEvent(event);
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
@@ -165,3 +144,253 @@ uint64 EventProcessor::CalculateQueueTime(uint64 delay) const
 {
     return CalculateTime(delay - (m_time % delay));
 }
+
+uint64 EventProcessor::GetTimeToNextEvent() const
+{
+    if (m_dueEvents)
+        return 0;
+
+    if (!m_wheelEventCount)
+        return std::numeric_limits<uint64>::max();
+
+    // the slot bits may still be set for slots that ran empty, which only makes the bound earlier
+    uint64 next;
+    uint32 index = m_wheelTime & (EVENT_WHEEL_SLOTS - 1);
+    if (uint64 pending = m_wheel->Occupied[0] & (~uint64(0) << index))
+        next = m_wheelTime - index + std::countr_zero(pending);
+    else
+        next = NextWheelBlock();
+
+    return next > m_time ? next - m_time : 0;
+}
+
+void EventProcessor::ScheduleEvent(BasicEvent* event)
+{
+    uint64 execTime = event->m_execTime;
+    if (execTime < m_wheelTime)
+    {
+        LinkEventSorted(&m_dueEvents, event);
+        return;
+    }
+
+    if (!m_wheel)
+        m_wheel = std::make_unique<EventWheel>();
+
+    ++m_wheelEventCount;
+
+    // the level is picked by the highest slot digit in which the event differs from the wheel time,
+    // so events of one slot always share every digit above it and cascade down together
+    uint64 diff = execTime ^ m_wheelTime;
+    if (diff >> EVENT_WHEEL_SPAN_BITS)
+    {
+        LinkEventSorted(&m_wheel->Overflow, event);
+        return;
+    }
+
+    uint32 level = diff ? (std::bit_width(diff) - 1) / EVENT_WHEEL_SLOT_BITS : 0;
+    uint32 slot = (execTime >> (level * EVENT_WHEEL_SLOT_BITS)) & (EVENT_WHEEL_SLOTS - 1);
+    LinkEvent(&m_wheel->Slots[level][slot], event, nullptr);
+    m_wheel->Occupied[level] |= uint64(1) << slot;
+}
+
+void EventProcessor::UnlinkEvent(BasicEvent* event)
+{
+    BasicEvent** queue = event->m_queue;
+    if (event->m_next == event)
+        *queue = nullptr;
+    else
+    {
+        event->m_prev->m_next = event->m_next;
+        event->m_next->m_prev = event->m_prev;
+        if (*queue == event)
+            *queue = event->m_next;
+    }
+
+    event->m_prev = nullptr;
+    event->m_next = nullptr;
+    event->m_queue = nullptr;
+
+    if (queue != &m_dueEvents)
+        --m_wheelEventCount;
+}
+
+// Moves the wheel time forward over slots known to be empty, cascading the higher level slots
+// (and the overflow queue) that start at the new time down the wheel
+void EventProcessor::AdvanceWheel(uint64 time)
+{
+    bool newBlock = (time ^ m_wheelTime) >> EVENT_WHEEL_SLOT_BITS;
+    m_wheelTime = time;
+    if (!newBlock || !m_wheelEventCount)
+        return;
+
+    if (!(time & ((uint64(1) << EVENT_WHEEL_SPAN_BITS) - 1)))
+    {
+        while (BasicEvent* event = m_wheel->Overflow)
+        {
+            if ((event->m_execTime >> EVENT_WHEEL_SPAN_BITS) != (time >> EVENT_WHEEL_SPAN_BITS))
+                break;
+
+            UnlinkEvent(event);
+            ScheduleEvent(event);
+        }
+    }
+
+    for (uint32 level = EVENT_WHEEL_LEVELS - 1; level > 0; --level)
+    {
+        uint32 shift = level * EVENT_WHEEL_SLOT_BITS;
+        if (time & ((uint64(1) << shift) - 1))
+            continue;
+
+        // taken from the front so events keep their order within the lower slots
+        uint32 index = (time >> shift) & (EVENT_WHEEL_SLOTS - 1);
+        BasicEvent** slot = &m_wheel->Slots[level][index];
+        while (BasicEvent* event = *slot)
+        {
+            UnlinkEvent(event);
+            ScheduleEvent(event);
+        }
+
+        m_wheel->Occupied[level] &= ~(uint64(1) << index);
+    }
+}
+
+// Start of the next higher level slot, or of the next overflow block, that may hold events
+uint64 EventProcessor::NextWheelBlock() const
+{
+    for (uint32 level = 1; level < EVENT_WHEEL_LEVELS; ++level)
+    {
+        uint32 shift = level * EVENT_WHEEL_SLOT_BITS;
+        uint32 index = (m_wheelTime >> shift) & (EVENT_WHEEL_SLOTS - 1);
+        if (uint64 pending = m_wheel->Occupied[level] & (~uint64(1) << index))
+            return ((m_wheelTime >> (shift + EVENT_WHEEL_SLOT_BITS)) << (shift + EVENT_WHEEL_SLOT_BITS)) | (uint64(std::countr_zero(pending)) << shift);
+    }
+
+    return ((m_wheelTime >> EVENT_WHEEL_SPAN_BITS) + 1) << EVENT_WHEEL_SPAN_BITS;
+}
+
+BasicEvent* EventProcessor::PopNextEvent()
+{
+    while (true)
+    {
+        // events that were already due when added sort before anything still in the wheel
+        if (BasicEvent* event = m_dueEvents)
+        {
+            UnlinkEvent(event);
+            return event;
+        }
+
+        if (m_wheelTime > m_time)
+            return nullptr;
+
+        if (!m_wheelEventCount)
+        {
+            // most processors only hold a few events now and then, don't keep the slots around while idle
+            m_wheel.reset();
+            m_wheelTime = m_time + 1;
+            return nullptr;
+        }
+
+        uint32 index = m_wheelTime & (EVENT_WHEEL_SLOTS - 1);
+        uint64 blockStart = m_wheelTime - index;
+        if (uint64 pending = m_wheel->Occupied[0] & (~uint64(0) << index))
+        {
+            index = std::countr_zero(pending);
+            if (blockStart + index > m_time)
+            {
+                m_wheelTime = m_time + 1;
+                return nullptr;
+            }
+
+            m_wheelTime = blockStart + index;
+            if (BasicEvent* event = m_wheel->Slots[0][index])
+            {
+                UnlinkEvent(event);
+                return event;
+            }
+
+            m_wheel->Occupied[0] &= ~(uint64(1) << index);
+            AdvanceWheel(m_wheelTime + 1);
+            continue;
+        }
+
+        AdvanceWheel(std::min(NextWheelBlock(), m_time + 1));
+    }
+}
+
+template<typename Predicate>
+std::vector<BasicEvent*> EventProcessor::DetachEvents(Predicate&& predicate)
+{
+    std::vector<BasicEvent*> events;
+    auto detach = [&](BasicEvent** queue)
+    {
+        BasicEvent* event = *queue;
+        while (event)
+        {
+            BasicEvent* next = event->m_next == *queue ? nullptr : event->m_next;
+            if (predicate(event))
+            {
+                UnlinkEvent(event);
+                events.push_back(event);
+            }
+
+            event = next;
+        }
+    };
+
+    detach(&m_dueEvents);
+    if (m_wheel)
+    {
+        for (uint32 level = 0; level < EVENT_WHEEL_LEVELS; ++level)
+            for (uint32 slot = 0; slot < EVENT_WHEEL_SLOTS; ++slot)
+                detach(&m_wheel->Slots[level][slot]);
+
+        detach(&m_wheel->Overflow);
+    }
+
+    return events;
+}
+
+// Inserts the event after 'after', or at the back of the queue when no position is given
+void EventProcessor::LinkEvent(BasicEvent** queue, BasicEvent* event, BasicEvent* after)
+{
+    event->m_queue = queue;
+    if (!*queue)
+    {
+        event->m_prev = event;
+        event->m_next = event;
+        *queue = event;
+        return;
+    }
+
+    BasicEvent* prev = after ? after : (*queue)->m_prev;
+    event->m_prev = prev;
+    event->m_next = prev->m_next;
+    prev->m_next->m_prev = event;
+    prev->m_next = event;
+}
+
+// Keeps the queue sorted by execution time, after any event with the same time
+void EventProcessor::LinkEventSorted(BasicEvent** queue, BasicEvent* event)
+{
+    BasicEvent* head = *queue;
+    if (!head)
+    {
+        LinkEvent(queue, event, nullptr);
+        return;
+    }
+
+    for (BasicEvent* prev = head->m_prev; ; prev = prev->m_prev)
+    {
+        if (prev->m_execTime <= event->m_execTime)
+        {
+            LinkEvent(queue, event, prev);
+            return;
+        }
+
+        if (prev == head)
+            break;
+    }
+
+    LinkEvent(queue, event, nullptr);
+    *queue = event;
+}
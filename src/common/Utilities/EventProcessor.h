@@ -21,7 +21,8 @@
 #include "Define.h"
 #include "Duration.h"
 #include "Random.h"
-#include <map>
+#include <memory>
+#include <vector>
 
 class EventProcessor;
 
@@ -68,6 +69,11 @@ class BasicEvent
         uint64 m_addTime{0};                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime{0};                                  // planned time of next execution, filled by event handler
         uint8 m_eventGroup{0};
+
+        // intrusive links into the owning EventProcessor's queues, so scheduling never allocates
+        BasicEvent* m_prev{nullptr};
+        BasicEvent* m_next{nullptr};
+        BasicEvent** m_queue{nullptr};                         // head of the queue this event is linked into, nullptr when not queued
 };
 
 template<typename T>
@@ -90,7 +96,14 @@ class LambdaBasicEvent : public BasicEvent
 template<typename T>
 using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::remove_pointer_t<std::remove_cvref_t<T>>>>;
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+// Events are kept in a hierarchical timer wheel: EVENT_WHEEL_LEVELS levels of EVENT_WHEEL_SLOTS
+// slots, each level covering EVENT_WHEEL_SLOTS times the span of the one below it, so adding,
+// moving and removing an event is O(1). Events scheduled past the wheel span wait in a sorted
+// overflow queue, events scheduled in the past run first on the next update.
+#define EVENT_WHEEL_SLOT_BITS   6
+#define EVENT_WHEEL_SLOTS       (1 << EVENT_WHEEL_SLOT_BITS)
+#define EVENT_WHEEL_LEVELS      4
+#define EVENT_WHEEL_SPAN_BITS   (EVENT_WHEEL_SLOT_BITS * EVENT_WHEEL_LEVELS)
 
 class EventProcessor
 {
@@ -98,6 +111,10 @@ class EventProcessor
         EventProcessor()  = default;
         ~EventProcessor();
 
+        // queued events stay owned by the source, a copy only takes over its clock
+        EventProcessor(EventProcessor const& right) : m_time(right.m_time), m_wheelTime(right.m_wheelTime) { }
+        EventProcessor& operator=(EventProcessor const&) = delete;
+
         void Update(uint32 p_time);
         void KillAllEvents(bool force);
 
@@ -113,6 +130,7 @@ class EventProcessor
         template<typename T>
         is_lambda_event<T> AddEventAtOffset(T&& event, Milliseconds offset, Milliseconds offset2, uint8 eventGroup = 0) { AddEventAtOffset(new LambdaBasicEvent<T>(std::move(event)), offset, offset2, eventGroup); };
 
+        // event must be queued in this processor, events that are not queued are left untouched
         void ModifyEventTime(BasicEvent* event, Milliseconds newTime);
         [[nodiscard]] uint64 CalculateTime(uint64 t_offset) const;
 
@@ -120,12 +138,36 @@ class EventProcessor
         [[nodiscard]] uint64 CalculateQueueTime(uint64 delay) const;
 
         void CancelEventGroup(uint8 group);
-        bool HasEvents() const { return !m_events.empty(); }
+        bool HasEvents() const { return m_dueEvents || m_wheelEventCount; }
+        // lower bound of the time until the next queued event is due, 0 when one is due now and UINT64_MAX without events
+        [[nodiscard]] uint64 GetTimeToNextEvent() const;
 
     protected:
         uint64 m_time{0};
-        EventList m_events;
-        bool m_aborting;
+
+    private:
+        struct EventWheel
+        {
+            BasicEvent* Slots[EVENT_WHEEL_LEVELS][EVENT_WHEEL_SLOTS] = { };
+            BasicEvent* Overflow = nullptr;
+            uint64 Occupied[EVENT_WHEEL_LEVELS] = { };         // slots that may hold events, one bit per slot
+        };
+
+        void ScheduleEvent(BasicEvent* event);
+        void UnlinkEvent(BasicEvent* event);
+        void AdvanceWheel(uint64 time);
+        [[nodiscard]] uint64 NextWheelBlock() const;
+        BasicEvent* PopNextEvent();
+        template<typename Predicate>
+        std::vector<BasicEvent*> DetachEvents(Predicate&& predicate);
+
+        static void LinkEvent(BasicEvent** queue, BasicEvent* event, BasicEvent* after);
+        static void LinkEventSorted(BasicEvent** queue, BasicEvent* event);
+
+        std::unique_ptr<EventWheel> m_wheel;                   // allocated with the first event that is not already due, freed by Update once empty
+        uint64 m_wheelTime{0};                                 // every wheel slot before this time has been run
+        uint32 m_wheelEventCount{0};
+        BasicEvent* m_dueEvents{nullptr};                      // events scheduled before m_wheelTime, sorted by time
 };
 
 #endif
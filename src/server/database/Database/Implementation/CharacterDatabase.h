@@ -367,7 +367,7 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS,
     CHAR_INS_CHAR_ACHIEVEMENT,
     CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA,
-    CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS,
+    CHAR_REP_CHAR_ACHIEVEMENT_PROGRESS,
     CHAR_INS_CHAR_ACHIEVEMENT_OFFLINE_UPDATES,
     CHAR_SEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES,
     CHAR_DEL_CHAR_ACHIEVEMENT_OFFLINE_UPDATES,
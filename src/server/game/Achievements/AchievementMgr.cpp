@@ -483,6 +483,8 @@ AchievementMgr::AchievementMgr(Player* player)
 {
     _player = player;
     _offlineUpdatesDelayTimer = 0;
+    _closedCriteria.resize(sAchievementCriteriaStore.GetNumRows(), false);
+    _closedCriteriaCountByType.fill(0);
 }
 
 AchievementMgr::~AchievementMgr()
@@ -507,6 +509,8 @@ void AchievementMgr::Reset()
 
     _completedAchievements.clear();
     _criteriaProgress.clear();
+    _closedCriteria.assign(_closedCriteria.size(), false);
+    _closedCriteriaCountByType.fill(0);
     DeleteFromDB(_player->GetGUID().GetCounter());
 
     // re-fill data
@@ -592,21 +596,24 @@ void AchievementMgr::SaveToDB(CharacterDatabaseTransaction trans)
             if (!iter->second.changed)
                 continue;
 
-            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA);
-            stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
-            stmt->SetData(1, iter->first);
-            trans->Append(stmt);
-
             // pussywizard: insert only for (counter != 0) is very important! this is how criteria of completed achievements gets deleted from db (by setting counter to 0); if conflicted during merge - contact me
+            // a single replace per changed criteria, the delete is only needed for criteria of completed achievements
+            CharacterDatabasePreparedStatement* stmt = nullptr;
             if (iter->second.counter)
             {
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_ACHIEVEMENT_PROGRESS);
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CHAR_ACHIEVEMENT_PROGRESS);
                 stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
                 stmt->SetData(1, iter->first);
                 stmt->SetData(2, iter->second.counter);
                 stmt->SetData(3, uint32(iter->second.date));
-                trans->Append(stmt);
             }
+            else
+            {
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_ACHIEVEMENT_PROGRESS_BY_CRITERIA);
+                stmt->SetData(0, GetPlayer()->GetGUID().GetCounter());
+                stmt->SetData(1, iter->first);
+            }
+            trans->Append(stmt);
 
             iter->second.changed = false;
 
@@ -633,6 +640,8 @@ void AchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, PreparedQ
             ca.date = time_t(fields[1].Get<uint32>());
             ca.changed = false;
 
+            CloseCriteriaOf(achievement);
+
             // title achievement rewards are retroactive
             if (AchievementReward const* reward = sAchievementMgr->GetAchievementReward(achievement))
                 if (uint32 titleId = reward->titleId[Player::TeamIdForRace(GetPlayer()->getRace())])
@@ -828,6 +837,12 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
 
     LOG_DEBUG("achievement", "AchievementMgr::UpdateAchievementCriteria({}, {}, {})", type, miscValue1, miscValue2);
 
+    // all criteria of this type belong to achievements already completed for good,
+    // scripts hooked on OnBeforeCheckCriteria still get to see every update
+    if (_closedCriteriaCountByType[type] >= sAchievementMgr->GetAchievementCriteriaByType(type)->size() &&
+        !sScriptMgr->HasBeforeCheckCriteriaScripts())
+        return;
+
     AchievementCriteriaEntryList const* achievementCriteriaList = nullptr;
 
     switch (type)
@@ -890,6 +905,9 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
+        if (IsClosedCriteria(achievementCriteria))
+            continue;
+
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
@@ -2295,6 +2313,7 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.date = GameTime::GetGameTime().count();
     ca.changed = true;
+    CloseCriteriaOf(achievement);
 
     sScriptMgr->OnPlayerAchievementComplete(GetPlayer(), achievement);
 
@@ -2440,6 +2459,30 @@ bool AchievementMgr::HasAchieved(uint32 achievementId) const
     return _completedAchievements.find(achievementId) != _completedAchievements.end();
 }
 
+// criteria of a completed achievement that no other achievement references will always be reported as completed by IsCompletedCriteria,
+// remember them so UpdateAchievementCriteria can skip them without any lookup
+void AchievementMgr::CloseCriteriaOf(AchievementEntry const* achievement)
+{
+    if (achievement->flags & (ACHIEVEMENT_FLAG_COUNTER | ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
+        return;
+
+    if (sAchievementMgr->GetAchievementByReferencedId(achievement->ID))
+        return;
+
+    AchievementCriteriaEntryList const* criteriaList = sAchievementMgr->GetAchievementCriteriaByAchievement(achievement->ID);
+    if (!criteriaList)
+        return;
+
+    for (AchievementCriteriaEntry const* criteria : *criteriaList)
+    {
+        if (criteria->ID >= _closedCriteria.size() || _closedCriteria[criteria->ID])
+            continue;
+
+        _closedCriteria[criteria->ID] = true;
+        ++_closedCriteriaCountByType[criteria->requiredType];
+    }
+}
+
 bool AchievementMgr::CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement)
 {
     if (sDisableMgr->IsDisabledFor(DISABLE_TYPE_ACHIEVEMENT_CRITERIA, criteria->ID, nullptr))
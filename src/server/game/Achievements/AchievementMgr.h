@@ -23,8 +23,10 @@
 #include "DBCStores.h"
 #include "DatabaseEnv.h"
 #include "ObjectGuid.h"
+#include <array>
 #include <map>
 #include <string>
+#include <vector>
 
 typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
@@ -325,6 +327,8 @@ private:
     bool IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
     bool IsCompletedAchievement(AchievementEntry const* entry);
     bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
+    void CloseCriteriaOf(AchievementEntry const* achievement);
+    [[nodiscard]] bool IsClosedCriteria(AchievementCriteriaEntry const* criteria) const { return criteria->ID < _closedCriteria.size() && _closedCriteria[criteria->ID]; }
     void BuildAllDataPacket(WorldPacket* data) const;
 
     void UpdateTimedAchievements(uint32 timeDiff);
@@ -339,6 +343,10 @@ private:
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap _timedAchievements;      // Criteria id/time left in MS
 
+    // criteria that can never be updated again (see CloseCriteriaOf), indexed by criteria id
+    std::vector<bool> _closedCriteria;
+    std::array<uint32, ACHIEVEMENT_CRITERIA_TYPE_TOTAL> _closedCriteriaCountByType;
+
     // Offline updates cannot be processed while players are loading,
     // as the player will not be notified of the changes.
     // To ensure proper notification, introduce a delay before processing.
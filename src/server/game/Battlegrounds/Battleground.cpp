@@ -712,15 +712,17 @@ Position const* Battleground::GetTeamStartPosition(TeamId teamId) const
 
 void Battleground::SendPacketToAll(WorldPacket const* packet)
 {
+    PacketBroadcaster broadcaster(packet);
     for (BattlegroundPlayerMap::const_iterator itr = m_Players.begin(); itr != m_Players.end(); ++itr)
-        itr->second->SendDirectMessage(packet);
+        broadcaster.SendTo(itr->second);
 }
 
 void Battleground::SendPacketToTeam(TeamId teamId, WorldPacket const* packet, Player* sender, bool self)
 {
+    PacketBroadcaster broadcaster(packet);
     for (BattlegroundPlayerMap::const_iterator itr = m_Players.begin(); itr != m_Players.end(); ++itr)
         if (itr->second->GetBgTeamId() == teamId && (self || sender != itr->second))
-            itr->second->SendDirectMessage(packet);
+            broadcaster.SendTo(itr->second);
 }
 
 void Battleground::SendChatMessage(Creature* source, uint8 textId, WorldObject* target /*= nullptr*/)
@@ -156,14 +156,40 @@ void BattlegroundMgr::Update(uint32 diff)
         LOG_TRACE("bg.arena", "BattlegroundMgr: UPDATING ARENA QUEUES");
 
         // for rated arenas
-        for (uint32 qtype = BATTLEGROUND_QUEUE_2v2; qtype < MAX_BATTLEGROUND_QUEUE_TYPES; ++qtype)
+        // opponent search of each arena type and bracket only reads its own queue, so it runs in parallel on the map update threads
+        // arenas are created and teams invited afterwards, here on the world thread
+        struct RatedArenaQueueUpdate
         {
+            BattlegroundQueueTypeId QueueTypeId;
+            BattlegroundBracketId BracketId;
+            RatedArenaMatch Match;
+        };
+
+        std::vector<RatedArenaQueueUpdate> ratedUpdates;
+        for (uint32 qtype = BATTLEGROUND_QUEUE_2v2; qtype < MAX_BATTLEGROUND_QUEUE_TYPES; ++qtype)
             for (uint32 bracket = BG_BRACKET_ID_FIRST; bracket < MAX_BATTLEGROUND_BRACKETS; ++bracket)
-            {
-                m_BattlegroundQueues[qtype].BattlegroundQueueUpdate(m_NextPeriodicQueueUpdateTime, BATTLEGROUND_AA, BattlegroundBracketId(bracket), BattlegroundMgr::BGArenaType(BattlegroundQueueTypeId(qtype)), true, 0);
-            }
+                if (!m_BattlegroundQueues[qtype].IsAllQueuesEmpty(BattlegroundBracketId(bracket)))
+                    ratedUpdates.push_back({ BattlegroundQueueTypeId(qtype), BattlegroundBracketId(bracket), RatedArenaMatch() });
+
+        MapUpdater* updater = sMapMgr->GetMapUpdater();
+        for (RatedArenaQueueUpdate& update : ratedUpdates)
+        {
+            BattlegroundQueue& queue = m_BattlegroundQueues[update.QueueTypeId];
+            if (queue.IsRatedQueueEmpty(update.BracketId))
+                continue;
+
+            if (updater->activated())
+                updater->schedule_arena_queue_search(queue, update.BracketId, update.Match);
+            else
+                queue.FindRatedArenaMatch(update.BracketId, 0, update.Match);
         }
 
+        if (updater->activated())
+            updater->wait();
+
+        for (RatedArenaQueueUpdate const& update : ratedUpdates)
+            m_BattlegroundQueues[update.QueueTypeId].BattlegroundQueueUpdate(m_NextPeriodicQueueUpdateTime, BATTLEGROUND_AA, update.BracketId, BattlegroundMgr::BGArenaType(update.QueueTypeId), true, 0, &update.Match);
+
         for (uint32 qtype = BATTLEGROUND_QUEUE_AV; qtype < MAX_BATTLEGROUND_QUEUE_TYPES; ++qtype)
         {
             for (uint32 bracket = BG_BRACKET_ID_FIRST; bracket < MAX_BATTLEGROUND_BRACKETS; ++bracket)
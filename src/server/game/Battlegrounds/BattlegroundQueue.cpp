@@ -49,6 +49,12 @@ BattlegroundQueue::BattlegroundQueue()
         }
     }
 
+    for (auto& counts : m_QueuedPlayersCount)
+        for (uint32& count : counts)
+            count = 0;
+
+    m_NextQueueId = 0;
+
     _queueAnnouncementTimer.fill(-1);
     _queueAnnouncementCrossfactioned = false;
 }
@@ -58,6 +64,10 @@ BattlegroundQueue::~BattlegroundQueue()
     m_events.KillAllEvents(false);
 
     m_QueuedPlayers.clear();
+    for (auto& ratedGroups : m_QueuedRatedGroups)
+        for (auto& index : ratedGroups)
+            index.clear();
+
     for (auto& m_QueuedGroup : m_QueuedGroups)
     {
         for (auto& j : m_QueuedGroup)
@@ -152,6 +162,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     ginfo->PreviousOpponentsTeamId      = opponentsArenaTeamId;
     ginfo->OpponentsTeamRating          = 0;
     ginfo->OpponentsMatchmakerRating    = 0;
+    ginfo->QueueId                      = ++m_NextQueueId;
 
     ginfo->Players.clear();
 
@@ -191,7 +202,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
     }
 
     //add GroupInfo to m_QueuedGroups
-    m_QueuedGroups[bracketId][index].push_back(ginfo);
+    AddQueuedGroup(ginfo, false);
 
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
@@ -306,7 +317,10 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     auto const& pitr = groupInfo->Players.find(guid);
     ASSERT(pitr != groupInfo->Players.end());
     if (pitr != groupInfo->Players.end())
+    {
         groupInfo->Players.erase(pitr);
+        --m_QueuedPlayersCount[_bracketId][_groupType];
+    }
 
     // if invited to bg, and should decrease invited count, then do it
     if (decreaseInvitedCount && groupInfo->IsInvitedToBGInstanceGUID)
@@ -338,7 +352,7 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove group queue info no players left
     if (groupInfo->Players.empty())
     {
-        m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
+        RemoveQueuedGroup(group_itr);
         delete groupInfo;
         return;
     }
@@ -364,6 +378,73 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     }
 }
 
+void BattlegroundQueue::AddQueuedGroup(GroupQueueInfo* ginfo, bool atFront)
+{
+    GroupsQueueType& groups = m_QueuedGroups[ginfo->BracketId][ginfo->GroupType];
+    if (atFront)
+        groups.push_front(ginfo);
+    else
+        groups.push_back(ginfo);
+
+    m_QueuedPlayersCount[ginfo->BracketId][ginfo->GroupType] += ginfo->Players.size();
+    AddToRatedIndex(ginfo);
+}
+
+BattlegroundQueue::GroupsQueueType::iterator BattlegroundQueue::RemoveQueuedGroup(GroupsQueueType::iterator itr)
+{
+    GroupQueueInfo* ginfo = *itr;
+
+    RemoveFromRatedIndex(ginfo);
+    m_QueuedPlayersCount[ginfo->BracketId][ginfo->GroupType] -= ginfo->Players.size();
+    return m_QueuedGroups[ginfo->BracketId][ginfo->GroupType].erase(itr);
+}
+
+// moves the group to the front of another queue of the same bracket
+void BattlegroundQueue::MoveQueuedGroup(GroupsQueueType::iterator itr, uint8 groupType)
+{
+    GroupQueueInfo* ginfo = *itr;
+
+    RemoveQueuedGroup(itr);
+    ginfo->GroupType = groupType; // pussywizard: update GroupQueueInfo internal variable
+    AddQueuedGroup(ginfo, true);
+}
+
+void BattlegroundQueue::AddToRatedIndex(GroupQueueInfo* ginfo)
+{
+    if (!ginfo->IsRated || ginfo->GroupType >= BG_QUEUE_NORMAL_ALLIANCE)
+        return;
+
+    m_QueuedRatedGroups[ginfo->BracketId][ginfo->GroupType].emplace(ginfo->ArenaMatchmakerRating, ginfo);
+}
+
+void BattlegroundQueue::RemoveFromRatedIndex(GroupQueueInfo* ginfo)
+{
+    if (!ginfo->IsRated || ginfo->GroupType >= BG_QUEUE_NORMAL_ALLIANCE)
+        return;
+
+    RatedGroupsQueueType& index = m_QueuedRatedGroups[ginfo->BracketId][ginfo->GroupType];
+    auto bounds = index.equal_range(ginfo->ArenaMatchmakerRating);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+    {
+        if (itr->second == ginfo)
+        {
+            index.erase(itr);
+            return;
+        }
+    }
+}
+
+// returns the rated team still queued under queueId, or nullptr if it left the queue
+GroupQueueInfo* BattlegroundQueue::FindQueuedRatedGroup(uint32 queueId, BattlegroundBracketId bracket_id) const
+{
+    for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; ++i)
+        for (GroupQueueInfo* ginfo : m_QueuedGroups[bracket_id][i])
+            if (ginfo->QueueId == queueId)
+                return ginfo;
+
+    return nullptr;
+}
+
 void BattlegroundQueue::AddEvent(BasicEvent* Event, uint64 e_time)
 {
     m_events.AddEventAtOffset(Event, Milliseconds(e_time));
@@ -561,9 +642,7 @@ bool BattlegroundQueue::CheckPremadeMatch(BattlegroundBracketId bracket_id, uint
             if (!(*itr)->IsInvitedToBGInstanceGUID && ((*itr)->JoinTime < time_before || (*itr)->Players.size() < MinPlayersPerTeam))
             {
                 //we must insert group to normal queue and erase pointer from premade queue
-                (*itr)->GroupType = BG_QUEUE_NORMAL_ALLIANCE + i; // pussywizard: update GroupQueueInfo internal variable
-                m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].push_front((*itr));
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].erase(itr);
+                MoveQueuedGroup(itr, BG_QUEUE_NORMAL_ALLIANCE + i);
             }
         }
     }
@@ -588,10 +667,16 @@ bool BattlegroundQueue::CheckNormalMatch(Battleground* bgTemplate, BattlegroundB
     if (sScriptMgr->IsCheckNormalMatch(this, bgTemplate, bracket_id, minPlayers, maxPlayers))
         return CanStartMatch();
 
+    // the pool of a team with less queued players than minPlayers can't start a match, only the .debug bg 1v0 needs it filled
+    bool const allowUnderMinimum = sBattlegroundMgr->isTesting() && bgTemplate->isBattleground();
+
     GroupsQueueType::const_iterator itr_team[PVP_TEAMS_COUNT];
     for (uint32 i = 0; i < PVP_TEAMS_COUNT; i++)
     {
         itr_team[i] = m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].begin();
+        if (!allowUnderMinimum && m_QueuedPlayersCount[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i] < minPlayers)
+            continue;
+
         for (; itr_team[i] != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].end(); ++(itr_team[i]))
         {
             if (!(*(itr_team[i]))->IsInvitedToBGInstanceGUID)
@@ -677,12 +762,8 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
     {
         //set correct team
         (*itr)->teamId = otherTeam;
-        (*itr)->GroupType = static_cast<uint8>(BG_QUEUE_NORMAL_ALLIANCE) + static_cast<uint8>(otherTeam);
 
-        //add team to other queue
-        m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(otherTeam)].push_front(*itr);
-
-        //remove team from old queue
+        //move team from old queue to other queue
         GroupsQueueType::iterator itr2 = itr_team;
         ++itr2;
 
@@ -690,7 +771,7 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
         {
             if (*itr2 == *itr)
             {
-                m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + static_cast<uint8>(teamIndex)].erase(itr2);
+                MoveQueuedGroup(itr2, static_cast<uint8>(BG_QUEUE_NORMAL_ALLIANCE) + static_cast<uint8>(otherTeam));
                 break;
             }
         }
@@ -704,7 +785,7 @@ void BattlegroundQueue::UpdateEvents(uint32 diff)
     m_events.Update(diff);
 }
 
-void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, uint8 arenaType, bool isRated, uint32 arenaRating)
+void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, uint8 arenaType, bool isRated, uint32 arenaRating, RatedArenaMatch const* precomputedMatch /*= nullptr*/)
 {
     // if no players in queue - do nothing
     if (IsAllQueuesEmpty(bracket_id))
@@ -825,135 +906,194 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
     // check if can start new rated arenas (can create many in single queue update)
     else if (bg_template->isArena())
     {
-        // found out the minimum and maximum ratings the newly added team should battle against
-        // arenaRating is the rating of the latest joined team, or 0
-        // 0 is on (automatic update call) and we must set it to team's with longest wait time
-        if (!arenaRating)
-        {
-            GroupQueueInfo* front1 = nullptr;
-            GroupQueueInfo* front2 = nullptr;
+        RatedArenaMatch match;
+        bool searchAgain = true;
 
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty())
-            {
-                front1 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].front();
-                arenaRating = front1->ArenaMatchmakerRating;
-            }
-
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
+        // the opponent search may have been done beforehand (see BattlegroundMgr::Update),
+        // only search again if one of the found teams was invited or left the queue since then
+        if (precomputedMatch && precomputedMatch->IsValid())
+        {
+            for (uint8 i = 0; i < PVP_TEAMS_COUNT; ++i)
             {
-                front2 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].front();
-                arenaRating = front2->ArenaMatchmakerRating;
+                match.QueueIds[i] = precomputedMatch->QueueIds[i];
+                match.Teams[i] = FindQueuedRatedGroup(match.QueueIds[i], bracket_id);
             }
 
-            if (front1 && front2)
-            {
-                if (front1->JoinTime < front2->JoinTime)
-                    arenaRating = front1->ArenaMatchmakerRating;
-            }
-            else if (!front1 && !front2)
-                return; // queues are empty
+            searchAgain = !match.IsValid() || match.Teams[TEAM_ALLIANCE]->IsInvitedToBGInstanceGUID || match.Teams[TEAM_HORDE]->IsInvitedToBGInstanceGUID;
         }
+        else if (precomputedMatch)
+            searchAgain = false;
 
-        //set rating range
-        uint32 arenaMinRating = (arenaRating <= sBattlegroundMgr->GetMaxRatingDifference()) ? 0 : arenaRating - sBattlegroundMgr->GetMaxRatingDifference();
-        uint32 arenaMaxRating = arenaRating + sBattlegroundMgr->GetMaxRatingDifference();
+        if (searchAgain)
+            FindRatedArenaMatch(bracket_id, arenaRating, match);
 
-        // if max rating difference is set and the time past since server startup is greater than the rating discard time
-        // (after what time the ratings aren't taken into account when making teams) then
-        // the discard time is current_time - time_to_discard, teams that joined after that, will have their ratings taken into account
-        // else leave the discard time on 0, this way all ratings will be discarded
-        // this has to be signed value - when the server starts, this value would be negative and thus overflow
-        int32 discardTime = GameTime::GetGameTimeMS().count() - sBattlegroundMgr->GetRatingDiscardTimer();
+        //if we have 2 teams, then start new arena and invite players!
+        if (match.IsValid())
+            StartRatedArenaMatch(match, bgTypeId, bracket_id, bracketEntry, arenaType);
+    }
+}
 
-        // timer for previous opponents
-        int32 discardOpponentsTime = GameTime::GetGameTimeMS().count() - sWorld->getIntConfig(CONFIG_ARENA_PREV_OPPONENTS_DISCARD_TIMER);
+// finds the 2 teams which will play the next rated arena of the bracket
+// only reads the queue, so searches for different brackets or arena types can be run in parallel
+bool BattlegroundQueue::FindRatedArenaMatch(BattlegroundBracketId bracket_id, uint32 arenaRating, RatedArenaMatch& match) const
+{
+    match = RatedArenaMatch();
 
-        // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[PVP_TEAMS_COUNT];
-        uint8 found = 0;
-        uint8 team = 0;
+    // found out the minimum and maximum ratings the newly added team should battle against
+    // arenaRating is the rating of the latest joined team, or 0
+    // 0 is on (automatic update call) and we must set it to team's with longest wait time
+    if (!arenaRating)
+    {
+        GroupQueueInfo* front1 = nullptr;
+        GroupQueueInfo* front2 = nullptr;
 
-        for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
+        if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty())
         {
-            // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
-            {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
-            }
+            front1 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].front();
+            arenaRating = front1->ArenaMatchmakerRating;
         }
 
-        if (!found)
-            return;
-
-        if (found == 1)
+        if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
         {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
-            {
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating) || (int32)(*itr3)->JoinTime < discardTime)
-                    && ((*(itr_teams[0]))->ArenaTeamId != (*itr3)->PreviousOpponentsTeamId || ((int32)(*itr3)->JoinTime < discardOpponentsTime))
-                    && (*(itr_teams[0]))->ArenaTeamId != (*itr3)->ArenaTeamId)
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
+            front2 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].front();
+            arenaRating = front2->ArenaMatchmakerRating;
         }
 
-        //if we have 2 teams, then start new arena and invite players!
-        if (found == 2)
+        if (front1 && front2)
         {
-            GroupQueueInfo* aTeam = *(itr_teams[TEAM_ALLIANCE]);
-            GroupQueueInfo* hTeam = *(itr_teams[TEAM_HORDE]);
+            if (front1->JoinTime < front2->JoinTime)
+                arenaRating = front1->ArenaMatchmakerRating;
+        }
+        else if (!front1 && !front2)
+            return false; // queues are empty
+    }
 
-            Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
-            if (!arena)
-            {
-                LOG_ERROR("bg.battleground", "BattlegroundQueue::Update couldn't create arena instance for rated arena match!");
-                return;
-            }
+    //set rating range
+    uint32 arenaMinRating = (arenaRating <= sBattlegroundMgr->GetMaxRatingDifference()) ? 0 : arenaRating - sBattlegroundMgr->GetMaxRatingDifference();
+    uint32 arenaMaxRating = arenaRating + sBattlegroundMgr->GetMaxRatingDifference();
 
-            aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
-            hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
-            aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
-            hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
+    // if max rating difference is set and the time past since server startup is greater than the rating discard time
+    // (after what time the ratings aren't taken into account when making teams) then
+    // the discard time is current_time - time_to_discard, teams that joined after that, will have their ratings taken into account
+    // else leave the discard time on 0, this way all ratings will be discarded
+    // this has to be signed value - when the server starts, this value would be negative and thus overflow
+    int32 discardTime = GameTime::GetGameTimeMS().count() - sBattlegroundMgr->GetRatingDiscardTimer();
 
-            LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", aTeam->ArenaTeamId, aTeam->OpponentsTeamRating);
-            LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", hTeam->ArenaTeamId, hTeam->OpponentsTeamRating);
+    // timer for previous opponents
+    int32 discardOpponentsTime = GameTime::GetGameTimeMS().count() - sWorld->getIntConfig(CONFIG_ARENA_PREV_OPPONENTS_DISCARD_TIMER);
 
-            // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
-            if (aTeam->teamId != TEAM_ALLIANCE)
-            {
-                aTeam->GroupType = BG_QUEUE_PREMADE_ALLIANCE;
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
-            }
+    auto isInRatingRange = [&](GroupQueueInfo const* ginfo)
+    {
+        return !ginfo->IsInvitedToBGInstanceGUID
+            && ((ginfo->ArenaMatchmakerRating >= arenaMinRating && ginfo->ArenaMatchmakerRating <= arenaMaxRating) || (int32)ginfo->JoinTime < discardTime);
+    };
+
+    // take the matching group that joined first
+    auto selectFirstJoined = [&](uint8 groupType, auto const& check) -> GroupQueueInfo*
+    {
+        GroupQueueInfo* selected = nullptr;
+
+        // groups waiting longer than the discard time ignore the rating window, they are all at the front of the queue
+        for (GroupQueueInfo* ginfo : m_QueuedGroups[bracket_id][groupType])
+        {
+            if (ginfo->IsInvitedToBGInstanceGUID)
+                continue;
 
-            if (hTeam->teamId != TEAM_HORDE)
+            if ((int32)ginfo->JoinTime >= discardTime)
+                break;
+
+            if (check(ginfo))
             {
-                hTeam->GroupType = BG_QUEUE_PREMADE_HORDE;
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
+                selected = ginfo;
+                break;
             }
+        }
 
-            arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
-            arena->SetArenaMatchmakerRating(TEAM_HORDE, hTeam->ArenaMatchmakerRating);
-            InviteGroupToBG(aTeam, arena, TEAM_ALLIANCE);
-            InviteGroupToBG(hTeam, arena, TEAM_HORDE);
+        // everything else has to be inside the rating window
+        RatedGroupsQueueType const& ratedGroups = m_QueuedRatedGroups[bracket_id][groupType];
+        for (auto itr = ratedGroups.lower_bound(arenaMinRating); itr != ratedGroups.end() && itr->first <= arenaMaxRating; ++itr)
+        {
+            GroupQueueInfo* ginfo = itr->second;
+            if ((!selected || ginfo->JoinTime < selected->JoinTime) && check(ginfo))
+                selected = ginfo;
+        }
+
+        return selected;
+    };
 
-            LOG_DEBUG("bg.battleground", "Starting rated arena match!");
-            arena->StartBattleground();
+    // we need to find 2 teams which will play next game
+    uint8 found = 0;
+    uint8 team = 0;
+
+    for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
+    {
+        if (GroupQueueInfo* ginfo = selectFirstJoined(i, isInRatingRange))
+        {
+            match.Teams[found++] = ginfo;
+            team = i;
         }
     }
+
+    if (found == 1)
+    {
+        GroupQueueInfo const* first = match.Teams[0];
+        match.Teams[found] = selectFirstJoined(team, [&](GroupQueueInfo const* ginfo)
+        {
+            return ginfo != first && ginfo->JoinTime >= first->JoinTime && isInRatingRange(ginfo)
+                && (first->ArenaTeamId != ginfo->PreviousOpponentsTeamId || ((int32)ginfo->JoinTime < discardOpponentsTime))
+                && first->ArenaTeamId != ginfo->ArenaTeamId;
+        });
+    }
+
+    for (uint8 i = 0; i < PVP_TEAMS_COUNT; ++i)
+        if (match.Teams[i])
+            match.QueueIds[i] = match.Teams[i]->QueueId;
+
+    return match.IsValid();
+}
+
+void BattlegroundQueue::StartRatedArenaMatch(RatedArenaMatch const& match, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, PvPDifficultyEntry const* bracketEntry, uint8 arenaType)
+{
+    GroupQueueInfo* aTeam = match.Teams[TEAM_ALLIANCE];
+    GroupQueueInfo* hTeam = match.Teams[TEAM_HORDE];
+
+    Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
+    if (!arena)
+    {
+        LOG_ERROR("bg.battleground", "BattlegroundQueue::Update couldn't create arena instance for rated arena match!");
+        return;
+    }
+
+    aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
+    hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
+    aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
+    hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
+
+    LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", aTeam->ArenaTeamId, aTeam->OpponentsTeamRating);
+    LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", hTeam->ArenaTeamId, hTeam->OpponentsTeamRating);
+
+    // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
+    auto moveToTeamQueue = [this, bracket_id](GroupQueueInfo* ginfo, uint8 groupType)
+    {
+        GroupsQueueType& groups = m_QueuedGroups[bracket_id][ginfo->GroupType];
+        auto itr = std::find(groups.begin(), groups.end(), ginfo);
+        if (itr != groups.end())
+            MoveQueuedGroup(itr, groupType);
+    };
+
+    if (aTeam->teamId != TEAM_ALLIANCE)
+        moveToTeamQueue(aTeam, BG_QUEUE_PREMADE_ALLIANCE);
+
+    if (hTeam->teamId != TEAM_HORDE)
+        moveToTeamQueue(hTeam, BG_QUEUE_PREMADE_HORDE);
+
+    arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
+    arena->SetArenaMatchmakerRating(TEAM_HORDE, hTeam->ArenaMatchmakerRating);
+    InviteGroupToBG(aTeam, arena, TEAM_ALLIANCE);
+    InviteGroupToBG(hTeam, arena, TEAM_HORDE);
+
+    LOG_DEBUG("bg.battleground", "Starting rated arena match!");
+    arena->StartBattleground();
 }
 
 void BattlegroundQueue::BattlegroundQueueAnnouncerUpdate(uint32 diff, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundBracketId bracket_id)
@@ -1022,6 +1162,11 @@ uint32 BattlegroundQueue::GetPlayersCountInGroupsQueue(BattlegroundBracketId bra
     return playersCount;
 }
 
+bool BattlegroundQueue::IsRatedQueueEmpty(BattlegroundBracketId bracket_id) const
+{
+    return m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty() && m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty();
+}
+
 bool BattlegroundQueue::IsAllQueuesEmpty(BattlegroundBracketId bracket_id)
 {
     uint8 queueEmptyCount = 0;
@@ -24,6 +24,7 @@
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
 #include <array>
+#include <map>
 
 constexpr auto COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME = 10;
 
@@ -46,6 +47,7 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  PreviousOpponentsTeamId;                        // excluded from the current queue until the timer is met
     uint8   BracketId;                                      // BattlegroundBracketId
     uint8   GroupType;                                      // BattlegroundQueueGroupTypes
+    uint32  QueueId;                                        // unique per queued group, unlike the pointer it is never reused
 };
 
 enum BattlegroundQueueGroupTypes
@@ -60,13 +62,23 @@ enum BattlegroundQueueGroupTypes
     BG_QUEUE_MAX = 10
 };
 
+// result of the (thread-safe) rated arena opponent search, committed later on the world thread
+// the teams are looked up again by QueueIds before commit, as Teams may point to groups which left the queue meanwhile
+struct RatedArenaMatch
+{
+    GroupQueueInfo* Teams[PVP_TEAMS_COUNT] = { nullptr, nullptr };
+    uint32 QueueIds[PVP_TEAMS_COUNT] = { 0, 0 };
+
+    [[nodiscard]] bool IsValid() const { return Teams[TEAM_ALLIANCE] && Teams[TEAM_HORDE]; }
+};
+
 class BattlegroundQueue
 {
 public:
     BattlegroundQueue();
     ~BattlegroundQueue();
 
-    void BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, uint8 arenaType, bool isRated, uint32 arenaRating);
+    void BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, uint8 arenaType, bool isRated, uint32 arenaRating, RatedArenaMatch const* precomputedMatch = nullptr);
     void BattlegroundQueueAnnouncerUpdate(uint32 diff, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundBracketId bracket_id);
     void UpdateEvents(uint32 diff);
 
@@ -74,6 +86,8 @@ public:
     bool CheckPremadeMatch(BattlegroundBracketId bracket_id, uint32 MinPlayersPerTeam, uint32 MaxPlayersPerTeam);
     bool CheckNormalMatch(Battleground* bgTemplate, BattlegroundBracketId bracket_id, uint32 minPlayers, uint32 maxPlayers);
     bool CheckSkirmishForSameFaction(BattlegroundBracketId bracket_id, uint32 minPlayersPerTeam);
+    bool FindRatedArenaMatch(BattlegroundBracketId bracket_id, uint32 arenaRating, RatedArenaMatch& match) const;
+    void StartRatedArenaMatch(RatedArenaMatch const& match, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, PvPDifficultyEntry const* bracketEntry, uint8 arenaType);
     GroupQueueInfo* AddGroup(Player* leader, Group* group, BattlegroundTypeId bgTypeId, PvPDifficultyEntry const* bracketEntry, uint8 arenaType, bool isRated, bool isPremade, uint32 arenaRating, uint32 matchmakerRating, uint32 arenaTeamId = 0, uint32 opponentsArenaTeamId = 0);
     void RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount);
     bool IsPlayerInvitedToRatedArena(ObjectGuid pl_guid);
@@ -84,6 +98,7 @@ public:
     void InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg, TeamId teamId);
     [[nodiscard]] uint32 GetPlayersCountInGroupsQueue(BattlegroundBracketId bracketId, BattlegroundQueueGroupTypes bgqueue);
     [[nodiscard]] bool IsAllQueuesEmpty(BattlegroundBracketId bracket_id);
+    [[nodiscard]] bool IsRatedQueueEmpty(BattlegroundBracketId bracket_id) const;
     void SendMessageBGQueue(Player* leader, Battleground* bg, PvPDifficultyEntry const* bracketEntry);
     void SendJoinMessageArenaQueue(Player* leader, GroupQueueInfo* ginfo, PvPDifficultyEntry const* bracketEntry, bool isRated);
     void SendExitMessageArenaQueue(GroupQueueInfo* ginfo);
@@ -96,16 +111,8 @@ public:
     //do NOT use deque because deque.erase() invalidates ALL iterators
     typedef std::list<GroupQueueInfo*> GroupsQueueType;
 
-    /*
-    This two dimensional array is used to store All queued groups
-    First dimension specifies the bgTypeId
-    Second dimension specifies the player's group types -
-         BG_QUEUE_PREMADE_ALLIANCE  is used for premade alliance groups and alliance rated arena teams
-         BG_QUEUE_PREMADE_HORDE     is used for premade horde groups and horde rated arena teams
-         BG_QUEUE_NORMAL_ALLIANCE   is used for normal (or small) alliance groups or non-rated arena matches
-         BG_QUEUE_NORMAL_HORDE      is used for normal (or small) horde groups or non-rated arena matches
-    */
-    GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_MAX];
+    // read only, the queues are changed through AddGroup/RemovePlayer so the indexes below stay in sync
+    [[nodiscard]] GroupsQueueType const& GetQueuedGroups(BattlegroundBracketId bracket_id, uint8 groupType) const { return m_QueuedGroups[bracket_id][groupType]; }
 
     // class to select and invite groups to bg
     class SelectionPool
@@ -129,6 +136,35 @@ public:
     [[nodiscard]] int32 GetQueueAnnouncementTimer(uint32 bracketId) const;
 
 private:
+    // every change of m_QueuedGroups goes through these, they keep m_QueuedRatedGroups and m_QueuedPlayersCount up to date
+    void AddQueuedGroup(GroupQueueInfo* ginfo, bool atFront);
+    GroupsQueueType::iterator RemoveQueuedGroup(GroupsQueueType::iterator itr);
+    void MoveQueuedGroup(GroupsQueueType::iterator itr, uint8 groupType);
+
+    void AddToRatedIndex(GroupQueueInfo* ginfo);
+    void RemoveFromRatedIndex(GroupQueueInfo* ginfo);
+    [[nodiscard]] GroupQueueInfo* FindQueuedRatedGroup(uint32 queueId, BattlegroundBracketId bracket_id) const;
+
+    /*
+    This two dimensional array is used to store All queued groups
+    First dimension specifies the bgTypeId
+    Second dimension specifies the player's group types -
+         BG_QUEUE_PREMADE_ALLIANCE  is used for premade alliance groups and alliance rated arena teams
+         BG_QUEUE_PREMADE_HORDE     is used for premade horde groups and horde rated arena teams
+         BG_QUEUE_NORMAL_ALLIANCE   is used for normal (or small) alliance groups or non-rated arena matches
+         BG_QUEUE_NORMAL_HORDE      is used for normal (or small) horde groups or non-rated arena matches
+    */
+    GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_MAX];
+
+    // rated arena teams of BG_QUEUE_PREMADE_ALLIANCE/BG_QUEUE_PREMADE_HORDE sorted by matchmaker rating,
+    // so the opponent search only visits teams inside the allowed rating window
+    typedef std::multimap<uint32, GroupQueueInfo*> RatedGroupsQueueType;
+    RatedGroupsQueueType m_QueuedRatedGroups[MAX_BATTLEGROUND_BRACKETS][PVP_TEAMS_COUNT];
+
+    // players in the groups of each queue, invited ones included, lets the matching skip teams which can not reach the minimum
+    uint32 m_QueuedPlayersCount[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_MAX];
+    uint32 m_NextQueueId;
+
     uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
     uint32 m_WaitTimeLastIndex[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
@@ -17,6 +17,7 @@
 
 #include "WhoListCacheMgr.h"
 #include "AreaDefines.h"
+#include "Guild.h"
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
 #include "World.h"
@@ -30,7 +31,9 @@ WhoListCacheMgr* WhoListCacheMgr::instance()
 
 void WhoListCacheMgr::Update()
 {
-    // clear current list
+    ++_updateCounter;
+
+    // clear current list, names are kept and only converted again when they changed
     _whoListStorage.clear();
     _whoListStorage.reserve(sWorldSessionMgr->GetPlayerCount() + 1);
 
@@ -39,25 +42,97 @@ void WhoListCacheMgr::Update()
         if (!player->FindMap() || player->GetSession()->PlayerLoading())
             continue;
 
-        std::string playerName = player->GetName();
-        std::wstring widePlayerName;
-
-        if (!Utf8toWStr(playerName, widePlayerName))
+        WhoListName const* playerName = UpdatePlayerName(player->GetGUID(), player->GetName());
+        if (!playerName)
             continue;
 
-        wstrToLower(widePlayerName);
-
-        std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
-        std::wstring wideGuildName;
-
-        if (!Utf8toWStr(guildName, wideGuildName))
+        WhoListName const* guildName = UpdateGuildName(player->GetGuildId());
+        if (!guildName)
             continue;
 
-        wstrToLower(wideGuildName);
-
         _whoListStorage.emplace_back(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->GetLevel(),
             player->getClass(), player->getRace(),
             (player->IsSpectator() ? AREA_DALARAN : player->GetZoneId()), player->getGender(), player->IsVisible(),
-            widePlayerName, wideGuildName, playerName, guildName);
+            playerName, guildName);
     }
+
+    // drop names of players and guilds that were not seen in this update
+    std::erase_if(_playerNames, [this](auto const& pair) { return pair.second.LastUpdate != _updateCounter; });
+    std::erase_if(_guildNames, [this](auto const& pair) { return pair.second.LastUpdate != _updateCounter; });
+
+    // index by level, race/class masks and zone so /who does not have to filter the whole list
+    // the list itself is not reordered, /who answers keep the order they had without the index
+    for (std::vector<uint32>& players : _levelIndex)
+        players.clear();
+
+    _levelRaceMask.fill(0);
+    _levelClassMask.fill(0);
+    for (auto& [zoneId, players] : _zoneIndex)
+        players.clear();
+
+    for (uint32 i = 0; i < _whoListStorage.size(); ++i)
+    {
+        WhoListPlayerInfo const& info = _whoListStorage[i];
+        _levelIndex[info.GetLevel()].push_back(i);
+        _levelRaceMask[info.GetLevel()] |= 1 << info.GetRace();
+        _levelClassMask[info.GetLevel()] |= 1 << info.GetClass();
+        _zoneIndex[info.GetZoneId()].push_back(i);
+    }
+}
+
+std::vector<uint32> const* WhoListCacheMgr::GetWhoListByZone(uint32 zoneId) const
+{
+    auto itr = _zoneIndex.find(zoneId);
+    if (itr == _zoneIndex.end() || itr->second.empty())
+        return nullptr;
+
+    return &itr->second;
+}
+
+WhoListName const* WhoListCacheMgr::UpdatePlayerName(ObjectGuid guid, std::string const& name)
+{
+    WhoListNameEntry& entry = _playerNames[guid];
+    if (entry.LastUpdate == 0 || entry.Name.Name != name)
+    {
+        entry.Name.Name = name;
+        entry.Name.WideName.clear();
+
+        if (!Utf8toWStr(name, entry.Name.WideName))
+        {
+            entry.LastUpdate = 0;
+            return nullptr;
+        }
+
+        wstrToLower(entry.Name.WideName);
+    }
+
+    entry.LastUpdate = _updateCounter;
+    return &entry.Name;
+}
+
+WhoListName const* WhoListCacheMgr::UpdateGuildName(uint32 guildId)
+{
+    WhoListNameEntry& entry = _guildNames[guildId];
+    if (entry.LastUpdate == _updateCounter)
+        return &entry.Name;
+
+    Guild* guild = guildId ? sGuildMgr->GetGuildById(guildId) : nullptr;
+    std::string name = guild ? guild->GetName() : "";
+
+    if (entry.LastUpdate == 0 || entry.Name.Name != name)
+    {
+        entry.Name.Name = name;
+        entry.Name.WideName.clear();
+
+        if (!Utf8toWStr(name, entry.Name.WideName))
+        {
+            entry.LastUpdate = 0;
+            return nullptr;
+        }
+
+        wstrToLower(entry.Name.WideName);
+    }
+
+    entry.LastUpdate = _updateCounter;
+    return &entry.Name;
 }
@@ -19,14 +19,24 @@
 #define _WHO_LISTCACHE_H_
 
 #include "Common.h"
+#include "DBCEnums.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <array>
+#include <unordered_map>
+
+// player and guild names are shared between the cached entries, conversions are only redone on rename
+struct WhoListName
+{
+    std::string Name;
+    std::wstring WideName;                                  // lower case, used for /who filtering
+};
 
 class WhoListPlayerInfo
 {
 public:
-    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, std::wstring const& widePlayerName,
-        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName) :
+    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible,
+        WhoListName const* playerName, WhoListName const* guildName) :
         _guid(guid),
         _team(team),
         _security(security),
@@ -36,8 +46,6 @@ public:
         _zoneid(zoneid),
         _gender(gender),
         _visible(visible),
-        _widePlayerName(widePlayerName),
-        _wideGuildName(wideGuildName),
         _playerName(playerName),
         _guildName(guildName) { }
 
@@ -50,10 +58,10 @@ public:
     uint32 GetZoneId() const { return _zoneid; }
     uint8 GetGender() const { return _gender; }
     bool IsVisible() const { return _visible; }
-    std::wstring const& GetWidePlayerName() const { return _widePlayerName; }
-    std::wstring const& GetWideGuildName() const { return _wideGuildName; }
-    std::string const& GetPlayerName() const { return _playerName; }
-    std::string const& GetGuildName() const { return _guildName; }
+    std::wstring const& GetWidePlayerName() const { return _playerName->WideName; }
+    std::wstring const& GetWideGuildName() const { return _guildName->WideName; }
+    std::string const& GetPlayerName() const { return _playerName->Name; }
+    std::string const& GetGuildName() const { return _guildName->Name; }
 
 private:
     ObjectGuid _guid;
@@ -65,10 +73,8 @@ private:
     uint32 _zoneid;
     uint8 _gender;
     bool _visible;
-    std::wstring _widePlayerName;
-    std::wstring _wideGuildName;
-    std::string _playerName;
-    std::string _guildName;
+    WhoListName const* _playerName;
+    WhoListName const* _guildName;
 };
 
 using WhoListInfoVector = std::vector<WhoListPlayerInfo>;
@@ -87,10 +93,36 @@ public:
     static WhoListCacheMgr* instance();
 
     void Update();
+
+    // the list keeps the order of ObjectAccessor::GetPlayers(), the indexes below are ascending indexes into it
     WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
+    std::vector<uint32> const& GetWhoListByLevel(uint8 level) const { return _levelIndex[level]; }
+    // nullptr if there are no players in that zone
+    std::vector<uint32> const* GetWhoListByZone(uint32 zoneId) const;
+
+    // masks of all races/classes cached for a level, (1 << race) and (1 << class) like CMSG_WHO
+    uint32 GetRaceMaskByLevel(uint8 level) const { return _levelRaceMask[level]; }
+    uint32 GetClassMaskByLevel(uint8 level) const { return _levelClassMask[level]; }
 
 protected:
+    struct WhoListNameEntry
+    {
+        WhoListName Name;
+        uint32 LastUpdate = 0;
+    };
+
+    WhoListName const* UpdatePlayerName(ObjectGuid guid, std::string const& name);
+    WhoListName const* UpdateGuildName(uint32 guildId);
+
     WhoListInfoVector _whoListStorage;
+    std::array<std::vector<uint32>, STRONG_MAX_LEVEL + 1> _levelIndex;
+    std::array<uint32, STRONG_MAX_LEVEL + 1> _levelRaceMask = {};
+    std::array<uint32, STRONG_MAX_LEVEL + 1> _levelClassMask = {};
+    std::unordered_map<uint32, std::vector<uint32>> _zoneIndex;
+
+    std::unordered_map<ObjectGuid, WhoListNameEntry> _playerNames;
+    std::unordered_map<uint32, WhoListNameEntry> _guildNames;
+    uint32 _updateCounter = 0;
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
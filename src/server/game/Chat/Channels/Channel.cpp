@@ -36,7 +36,8 @@ Channel::Channel(std::string const& name, uint32 channelId, uint32 channelDBId,
     _channelDBId(channelDBId),
     _teamId(teamId),
     _name(name),
-    _password("")
+    _password(""),
+    _leavesSinceFilterRebuild(0)
 {
     // set special flags if built-in channel
     if (ChatChannelsEntry const* ch = sChatChannelsStore.LookupEntry(channelId)) // check whether it's a built-in channel
@@ -207,7 +208,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.flags = MEMBER_FLAG_NONE;
     pinfo.plrPtr = player;
 
-    playersStore[guid] = pinfo;
+    AddMember(pinfo);
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->GetSession()).PSendSysMessage("{}", _channelRights.joinMessage);
@@ -271,7 +272,7 @@ void Channel::LeaveChannel(Player* player, bool send)
 
     bool changeowner = playersStore[guid].IsOwner();
 
-    playersStore.erase(guid);
+    RemoveMember(guid);
     if (_announce && ShouldAnnouncePlayer(player))
     {
         WorldPacket data;
@@ -438,7 +439,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
 
     if (isOnChannel)
     {
-        playersStore.erase(victim);
+        RemoveMember(victim);
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -906,16 +907,24 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->SendDirectMessage(data);
+    // nobody in the channel ignores the sender, skip the per member social lookup
+    if (guid && _ignoredByMembers.find(guid) == _ignoredByMembers.end())
+        guid = ObjectGuid::Empty;
+
+    // sends are not grouped per network thread: every socket has its own lock-free queue which only its network thread drains,
+    // so a send is already a single enqueue, and bot members have no socket at all
+    PacketBroadcaster broadcaster(data);
+    for (Player* member : _members)
+        if (!guid || !member->GetSocial()->HasIgnore(guid))
+            broadcaster.SendTo(member);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (i->first != who)
-            i->second.plrPtr->SendDirectMessage(data);
+    PacketBroadcaster broadcaster(data);
+    for (Player* member : _members)
+        if (member->GetGUID() != who)
+            broadcaster.SendTo(member);
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
@@ -930,6 +939,54 @@ void Channel::SendToAllWatching(WorldPacket* data)
         (*i)->SendDirectMessage(data);
 }
 
+void Channel::AddMember(PlayerInfo const& pinfo)
+{
+    PlayerInfo& member = playersStore[pinfo.player];
+    member = pinfo;
+    member.memberIndex = _members.size();
+    _members.push_back(pinfo.plrPtr);
+
+    pinfo.plrPtr->GetSocial()->DoForAllIgnored([this](ObjectGuid const& ignored)
+    {
+        _ignoredByMembers.insert(ignored);
+    });
+}
+
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    PlayerContainer::iterator itr = playersStore.find(guid);
+    if (itr == playersStore.end())
+        return;
+
+    // swap with the last member to keep _members dense
+    uint32 index = itr->second.memberIndex;
+    if (index < _members.size() && _members[index] == itr->second.plrPtr)
+    {
+        Player* last = _members.back();
+        _members[index] = last;
+        _members.pop_back();
+        if (last != itr->second.plrPtr)
+            playersStore[last->GetGUID()].memberIndex = index;
+    }
+
+    playersStore.erase(itr);
+
+    // ignores of players that left stay in the filter, drop them once enough members came and went
+    if (++_leavesSinceFilterRebuild > _members.size())
+        RebuildIgnoreFilter();
+}
+
+void Channel::RebuildIgnoreFilter()
+{
+    _leavesSinceFilterRebuild = 0;
+    _ignoredByMembers.clear();
+    for (Player* member : _members)
+        member->GetSocial()->DoForAllIgnored([this](ObjectGuid const& ignored)
+        {
+            _ignoredByMembers.insert(ignored);
+        });
+}
+
 bool Channel::ShouldAnnouncePlayer(Player const* player) const
 {
     return !(player->GetSession()->IsGMAccount() && sWorld->getBoolConfig(CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL));
@@ -21,6 +21,7 @@
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include <string>
+#include <vector>
 
 class Player;
 
@@ -147,6 +148,7 @@ class Channel
         ObjectGuid player;
         uint8 flags;
         Player* plrPtr; // pussywizard
+        uint32 memberIndex = 0; // position in _members
 
         [[nodiscard]] bool HasFlag(uint8 flag) const { return flags & flag; }
         void SetFlag(uint8 flag) { if (!HasFlag(flag)) flags |= flag; }
@@ -221,6 +223,9 @@ public:
     void AddWatching(Player* p);
     void RemoveWatching(Player* p);
 
+    // a member started ignoring someone, keep the ignore prefilter of SendToAll conservative
+    void AddIgnoreFilter(ObjectGuid ignored) { _ignoredByMembers.insert(ignored); }
+
 private:
     // initial packet data (notify type and channel name)
     void MakeNotifyPacket(WorldPacket* data, uint8 notify_type);
@@ -269,6 +274,10 @@ private:
 
     bool ShouldAnnouncePlayer(Player const* player) const;
 
+    void AddMember(PlayerInfo const& pinfo);
+    void RemoveMember(ObjectGuid guid);
+    void RebuildIgnoreFilter();
+
     [[nodiscard]] bool IsOn(ObjectGuid who) const { return playersStore.find(who) != playersStore.end(); }
     [[nodiscard]] bool IsBanned(ObjectGuid guid) const;
 
@@ -333,5 +342,11 @@ private:
     PlayerContainer playersStore;
     BannedContainer bannedStore;
     PlayersWatchingContainer playersWatchingStore;
+
+    // dense copy of the members for broadcasts, kept in sync with playersStore
+    std::vector<Player*> _members;
+    // guids ignored by at least one member (may contain stale entries, never misses one)
+    GuidUnorderedSet _ignoredByMembers;
+    uint32 _leavesSinceFilterRebuild;
 };
 #endif
@@ -254,6 +254,23 @@ void ThreatContainer::clearReferences()
     }
 
     iThreatList.clear();
+    iThreatIndex.clear();
+}
+
+void ThreatContainer::remove(HostileReference* hostileRef)
+{
+    StorageType::iterator itr = std::find(iThreatList.begin(), iThreatList.end(), hostileRef);
+    if (itr == iThreatList.end())
+        return;
+
+    iThreatList.erase(itr);
+    iThreatIndex.erase(hostileRef->getUnitGuid());
+}
+
+void ThreatContainer::addReference(HostileReference* hostileRef)
+{
+    iThreatList.push_back(hostileRef);
+    iThreatIndex[hostileRef->getUnitGuid()] = hostileRef;
 }
 
 //============================================================
@@ -268,16 +285,8 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit const* victim) cons
 
 HostileReference* ThreatContainer::getReferenceByTarget(ObjectGuid const& guid) const
 {
-    for (ThreatContainer::StorageType::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-    {
-        HostileReference* ref = (*i);
-        if (ref && ref->getUnitGuid() == guid)
-        {
-            return ref;
-        }
-    }
-
-    return nullptr;
+    auto itr = iThreatIndex.find(guid);
+    return itr != iThreatIndex.end() ? itr->second : nullptr;
 }
 
 //============================================================
@@ -305,7 +314,21 @@ void ThreatContainer::ModifyThreatByPercent(Unit* victim, int32 percent)
 void ThreatContainer::update()
 {
     if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(Acore::ThreatOrderPred());
+    {
+        // the list was sorted on the previous update and usually only a few references moved since,
+        // an insertion sort is close to linear then and keeps equal threats in place like list::sort did.
+        // Only ordering the top entries would not be cheaper here, and GetSortedThreatList and the
+        // SelectTarget position/MinThreat lookups need the whole list in order
+        Acore::ThreatOrderPred pred;
+        for (std::size_t i = 1; i < iThreatList.size(); ++i)
+        {
+            HostileReference* ref = iThreatList[i];
+            std::size_t j = i;
+            for (; j > 0 && pred(ref, iThreatList[j - 1]); --j)
+                iThreatList[j] = iThreatList[j - 1];
+            iThreatList[j] = ref;
+        }
+    }
 
     iDirty = false;
 }
@@ -332,6 +355,9 @@ HostileReference* ThreatContainer::SelectNextVictim(Creature* attacker, HostileR
             currentVictim = nullptr;
     }
 
+    if (iThreatList.empty())
+        return nullptr;
+
     ThreatContainer::StorageType::const_iterator lastRef = iThreatList.end();
     --lastRef;
 
@@ -654,8 +680,10 @@ void ThreatMgr::ResetAllThreat()
     if (threatList.empty())
         return;
 
-    for (HostileReference* ref : threatList)
+    // by index, adding threat may append the owner of a pet to the list
+    for (std::size_t i = 0; i < threatList.size(); ++i)
     {
+        HostileReference* ref = threatList[i];
         // Reset temp threat before setting threat back to 0.
         ref->resetTempThreat();
         ref->SetThreat(0.f);
@@ -24,6 +24,8 @@
 #include "SharedDefines.h"
 #include "UnitEvents.h"
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 //==============================================================
 
@@ -144,7 +146,7 @@ class ThreatContainer
     friend class ThreatMgr;
 
 public:
-    typedef std::list<HostileReference*> StorageType;
+    typedef std::vector<HostileReference*> StorageType;
 
     ThreatContainer() = default;
 
@@ -176,15 +178,8 @@ public:
     [[nodiscard]] StorageType const& GetThreatList() const { return iThreatList; }
 
 private:
-    void remove(HostileReference* hostileRef)
-    {
-        iThreatList.remove(hostileRef);
-    }
-
-    void addReference(HostileReference* hostileRef)
-    {
-        iThreatList.push_back(hostileRef);
-    }
+    void remove(HostileReference* hostileRef);
+    void addReference(HostileReference* hostileRef);
 
     void clearReferences();
 
@@ -192,6 +187,7 @@ private:
     void update();
 
     StorageType iThreatList;
+    std::unordered_map<ObjectGuid, HostileReference*> iThreatIndex; // victim guid => reference in iThreatList
     bool iDirty{false};
 };
 
@@ -224,8 +220,8 @@ public:
     [[nodiscard]] bool isThreatListEmpty() const { return iThreatContainer.empty(); }
     [[nodiscard]] bool areThreatListsEmpty() const { return iThreatContainer.empty() && iThreatOfflineContainer.empty(); }
 
-    Acore::IteratorPair<std::list<ThreatReference*>::const_iterator> GetSortedThreatList() const { auto& list = iThreatContainer.GetThreatList(); return { list.cbegin(), list.cend() }; }
-    Acore::IteratorPair<std::list<ThreatReference*>::const_iterator> GetUnsortedThreatList() const { return GetSortedThreatList(); }
+    Acore::IteratorPair<ThreatContainer::StorageType::const_iterator> GetSortedThreatList() const { auto& list = iThreatContainer.GetThreatList(); return { list.cbegin(), list.cend() }; }
+    Acore::IteratorPair<ThreatContainer::StorageType::const_iterator> GetUnsortedThreatList() const { return GetSortedThreatList(); }
 
     void processThreatEvent(ThreatRefStatusChangeEvent* threatRefStatusChangeEvent);
 
@@ -258,8 +254,10 @@ public:
         if (threatList.empty())
             return;
 
-        for (auto& ref : threatList)
+        // by index, adding threat may append the owner of a pet to the list
+        for (std::size_t i = 0; i < threatList.size(); ++i)
         {
+            HostileReference* ref = threatList[i];
             if (predicate(ref->getTarget()))
             {
                 ref->SetThreat(0);
@@ -268,8 +266,12 @@ public:
         }
     }
 
+    [[nodiscard]] bool IsThreatenedBy(Unit const* who, bool includeOffline = false) const { return FindReference(who, includeOffline) != nullptr; }
+
     // methods to access the lists from the outside to do some dirty manipulation (scriping and such)
     // I hope they are used as little as possible.
+    // The lists are vectors: adding threat (a pet's owner is appended), a reference going on- or offline and
+    // re-sorting all invalidate iterators, so copy the list first when the loop body can change threat.
     [[nodiscard]] ThreatContainer::StorageType const& GetThreatList() const { return iThreatContainer.GetThreatList(); }
     [[nodiscard]] ThreatContainer::StorageType const& GetOfflineThreatList() const { return iThreatOfflineContainer.GetThreatList(); }
     ThreatContainer& GetOnlineContainer() { return iThreatContainer; }
@@ -2055,6 +2055,11 @@ void Creature::Respawn(bool force)
             m_respawnedTime = GameTime::GetGameTime().count();
             setDeathState(DeathState::JustRespawned);
 
+            // respawned by a script while sleeping, wake up to run the AI reset and movement, the time
+            // spent dead is not caught up on
+            if (IsInWorld())
+                GetMap()->AddObjectToPendingUpdateList(this, false);
+
             // MDic - Acidmanifesto: Do not override transform auras
             if (GetAuraEffectsByType(SPELL_AURA_TRANSFORM).empty())
             {
@@ -3767,5 +3772,9 @@ bool Creature::IsUpdateNeeded()
     if (m_formation && m_formation->GetLeader() != this)
         return true;
 
+    // delayed events due before the next recheck, later ones wake the creature up from the map
+    if (m_Events.GetTimeToNextEvent() < UPDATABLE_OBJECT_LIST_RECHECK_TIMER)
+        return true;
+
     return false;
 }
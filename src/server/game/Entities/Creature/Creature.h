@@ -436,6 +436,12 @@ public:
 
     bool IsUpdateNeeded() override;
 
+    // Map update level of detail, time skipped between two updates is handed to the next one
+    [[nodiscard]] uint8 GetUpdateLodLevel() const { return _updateLodLevel; }
+    void SetUpdateLodLevel(uint8 level) { _updateLodLevel = level; }
+    void DeferUpdateLodDiff(uint32 diff) { _updateLodDiff += diff; }
+    uint32 TakeUpdateLodDiff(uint32 diff) { diff += _updateLodDiff; _updateLodDiff = 0; return diff; }
+
 protected:
     bool CreateFromProto(ObjectGuid::LowType guidlow, uint32 Entry, uint32 vehId, const CreatureData* data = nullptr);
     bool InitEntry(uint32 entry, const CreatureData* data = nullptr);
@@ -528,6 +534,9 @@ private:
 
     uint32 m_assistanceTimer;
 
+    uint32 _updateLodDiff{0};
+    uint8 _updateLodLevel{0};
+
     uint32 _playerDamageReq;
     bool _damagedByPlayer;
     bool _isCombatMovementAllowed;
@@ -2606,6 +2606,10 @@ void GameObject::EnableCollision(bool enable)
         phaseMask = GetPhaseMask();
 
     m_model->enable(phaseMask);
+
+    // doors opening or closing change the line of sight of the whole map
+    if (Map* map = FindMap())
+        map->InvalidateLineOfSightCache();
 }
 
 void GameObject::UpdateModel()
@@ -257,6 +257,9 @@ void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target)
 
 void Object::BuildOutOfRangeUpdateBlock(UpdateData* data) const
 {
+    if (Unit const* unit = ToUnit())
+        unit->FlushQueuedMonsterMoves();
+
     data->AddOutOfRangeGUID(GetGUID());
 }
 
@@ -264,6 +267,9 @@ void Object::DestroyForPlayer(Player* target, bool onDeath) const
 {
     ASSERT(target);
 
+    if (Unit const* unit = ToUnit())
+        unit->FlushQueuedMonsterMoves();
+
     if (IsUnit() || isType(TYPEMASK_PLAYER))
     {
         if (Battleground* bg = target->GetBattleground())
@@ -540,8 +546,14 @@ void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map)
         std::pair<UpdateDataMapType::iterator, bool> p = data_map.insert(UpdateDataMapType::value_type(player, UpdateData()));
         ASSERT(p.second);
         iter = p.first;
+
+        if (!sScriptMgr->OnPlayerbotCheckUpdatesToSend(player))
+            iter->second.SetDiscarded();
     }
 
+    if (iter->second.IsDiscarded())
+        return;
+
     BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
 }
 
@@ -2088,16 +2100,26 @@ void WorldObject::SendMessageToSet(WorldPacket const* data, bool self) const
 
 void WorldObject::SendMessageToSetInRange(WorldPacket const* data, float dist, bool /*self*/) const
 {
+    FlushQueuedMonsterMoves();
+
     Acore::MessageDistDeliverer notifier(this, data, dist);
     notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
 }
 
 void WorldObject::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
 {
+    FlushQueuedMonsterMoves();
+
     Acore::MessageDistDeliverer notifier(this, data, 0.0f, false, skipped_rcvr);
     notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
 }
 
+void WorldObject::FlushQueuedMonsterMoves() const
+{
+    if (Map* map = FindMap())
+        map->GetMonsterMoveBatch().FlushMover(this);
+}
+
 void WorldObject::SendObjectDeSpawnAnim(ObjectGuid guid)
 {
     WorldPacket data(SMSG_GAMEOBJECT_DESPAWN_ANIM, 8);
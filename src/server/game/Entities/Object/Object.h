@@ -462,9 +462,14 @@ private:
         return _mapUpdateState;
     }
 
+    // game time at which the object was parked off the map update list, zero while it is not sleeping
+    void SetMapUpdateParkedTime(Milliseconds time) { _mapUpdateParkedTime = time; }
+    Milliseconds GetMapUpdateParkedTime() const { return _mapUpdateParkedTime; }
+
 private:
     std::size_t _mapUpdateListOffset;
     UpdateState _mapUpdateState;
+    Milliseconds _mapUpdateParkedTime{0};
 };
 
 class WorldObject : public Object, public WorldLocation
@@ -558,6 +563,8 @@ public:
     virtual void CleanupsBeforeDelete(bool finalCleanup = true);  // used in destructor or explicitly before mass creature delete to remove cross-references to already deleted units
 
     virtual void SendMessageToSet(WorldPacket const* data, bool self) const;
+    // sends the monster moves still queued for this object on its map, before a packet that must not overtake them
+    void FlushQueuedMonsterMoves() const;
     virtual void SendMessageToSetInRange(WorldPacket const* data, float dist, bool self) const;
     virtual void SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const;
 
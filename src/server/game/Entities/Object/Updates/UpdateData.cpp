@@ -23,7 +23,7 @@
 #include "World.h"
 #include "WorldPacket.h"
 
-UpdateData::UpdateData() : m_blockCount(0)
+UpdateData::UpdateData() : m_blockCount(0), m_discarded(false)
 {
     m_outOfRangeGUIDs.reserve(15);
 }
@@ -60,8 +60,13 @@ public:
     [[nodiscard]] bool HasData() const { return m_blockCount > 0 || !m_outOfRangeGUIDs.empty(); }
     void Clear();
 
+    // Set for receivers that do not take object updates (playerbots), nothing gets built for them
+    void SetDiscarded() { m_discarded = true; }
+    [[nodiscard]] bool IsDiscarded() const { return m_discarded; }
+
 protected:
     uint32 m_blockCount;
+    bool m_discarded;
     GuidVector m_outOfRangeGUIDs;
     ByteBuffer m_data;
 };
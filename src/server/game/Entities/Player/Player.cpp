@@ -1342,6 +1342,8 @@ uint8 Player::GetChatTag() const
 
 void Player::SendTeleportAckPacket()
 {
+    FlushQueuedMonsterMoves();
+
     WorldPacket data(MSG_MOVE_TELEPORT_ACK, 41);
     data << GetPackGUID();
     data << GetSession()->GetOrderCounter(); // movement counter
@@ -4934,6 +4936,12 @@ bool Player::IsInChannel(const Channel* c)
     });
 }
 
+void Player::AddChannelIgnoreFilter(ObjectGuid ignored)
+{
+    for (Channel* channel : m_channels)
+        channel->AddIgnoreFilter(ignored);
+}
+
 void Player::ClearChannelWatch()
 {
     for (JoinedChannelsList::iterator itr = m_channels.begin(); itr != m_channels.end(); ++itr)
@@ -5678,6 +5686,8 @@ void Player::SendMessageToSet(WorldPacket const* data, bool self) const
 
 void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool self) const
 {
+    FlushQueuedMonsterMoves();
+
     if (self)
         SendDirectMessage(data);
 
@@ -5687,6 +5697,8 @@ void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool s
 
 void Player::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
 {
+    FlushQueuedMonsterMoves();
+
     if (skipped_rcvr != this)
         SendDirectMessage(data);
 
@@ -5699,6 +5711,11 @@ void Player::SendDirectMessage(WorldPacket const* data) const
     m_session->SendPacket(data);
 }
 
+void Player::SendDirectMessage(SharedWorldPacket const& data) const
+{
+    m_session->SendPacket(data);
+}
+
 void Player::SendCinematicStart(uint32 CinematicSequenceId) const
 {
     WorldPacket data(SMSG_TRIGGER_CINEMATIC, 4);
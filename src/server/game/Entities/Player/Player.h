@@ -2061,6 +2061,7 @@ public:
     void JoinedChannel(Channel* c);
     void LeftChannel(Channel* c);
     bool IsInChannel(const Channel* c);
+    void AddChannelIgnoreFilter(ObjectGuid ignored);
     void CleanupChannels();
     void ClearChannelWatch();
     void UpdateLFGChannel();
@@ -2243,6 +2244,7 @@ public:
     void SendInitWorldStates(uint32 zoneId, uint32 areaId);
     void SendUpdateWorldState(uint32 variable, uint32 value) const;
     void SendDirectMessage(WorldPacket const* data) const;
+    void SendDirectMessage(SharedWorldPacket const& data) const;
     void SendBGWeekendWorldStates();
     void SendBattlefieldWorldStates();
 
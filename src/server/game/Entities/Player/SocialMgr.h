@@ -115,6 +115,14 @@ class PlayerSocial
         ObjectGuid const& GetPlayerGUID() const { return m_playerGUID; }
         void SetPlayerGUID(ObjectGuid const& guid) { m_playerGUID = guid; }
         uint32 GetNumberOfSocialsWithFlag(SocialFlag flag) const;
+
+        template<typename Worker>
+        void DoForAllIgnored(Worker&& worker) const
+        {
+            for (auto const& [guid, info] : m_playerSocialMap)
+                if (info.Flags & SOCIAL_FLAG_IGNORED)
+                    worker(guid);
+        }
     private:
         bool _checkContact(ObjectGuid const& guid, SocialFlag flags) const;
         typedef std::map<ObjectGuid, FriendInfo> PlayerSocialMap;
@@ -71,6 +71,7 @@
 #include "Vehicle.h"
 #include "World.h"
 #include "WorldPacket.h"
+#include <boost/container/small_vector.hpp>
 #include <cmath>
 
 float baseMoveSpeed[MAX_MOVE_TYPE] =
@@ -4601,6 +4602,7 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint8 effMask)
 
     AuraApplication* aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
+    _AddProcAura(aurApp);
 
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: even if it gets removed, it will be reapplied in a second
@@ -4697,6 +4699,7 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
 
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
+    _RemoveProcAura(aurApp);
 
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: event if it gets removed, it will be reapplied in a second
@@ -4824,6 +4827,103 @@ void Unit::_RegisterAuraEffect(AuraEffect* aurEff, bool apply)
         m_modAuras[aurEff->GetAuraType()].erase(std::remove(m_modAuras[aurEff->GetAuraType()].begin(), m_modAuras[aurEff->GetAuraType()].end(), aurEff), m_modAuras[aurEff->GetAuraType()].end());
 }
 
+// Proc flags the aura reacts to in ProcDamageAndSpellFor, mirrors the lookups of IsTriggeredAtSpellProcEvent
+static uint32 GetProcDamageAndSpellFlags(SpellInfo const* spellProto)
+{
+    // handled by the new proc system
+    if (sSpellMgr->GetSpellProcEntry(spellProto->Id))
+        return 0;
+
+    SpellProcEventEntry const* spellProcEvent = sSpellMgr->GetSpellProcEvent(spellProto->Id);
+    if (spellProcEvent && spellProcEvent->procFlags)
+        return spellProcEvent->procFlags;
+
+    return spellProto->ProcFlags;
+}
+
+void Unit::_AddProcAura(AuraApplication* aurApp)
+{
+    uint32 procFlags = GetProcDamageAndSpellFlags(aurApp->GetBase()->GetSpellInfo());
+    if (!procFlags)
+        return;
+
+    _ModifyProcAuraFlags(procFlags, true);
+
+    ProcAuraEntry entry = { aurApp, aurApp->GetBase()->GetId(), procFlags };
+    if (m_procAurasIterating)
+        m_pendingProcAuras.push_back(entry);
+    else
+        _InsertProcAura(entry);
+}
+
+void Unit::_RemoveProcAura(AuraApplication* aurApp)
+{
+    auto matches = [aurApp](ProcAuraEntry const& entry) { return entry.Application == aurApp; };
+
+    auto itr = std::find_if(m_procAuras.begin(), m_procAuras.end(), matches);
+    if (itr != m_procAuras.end())
+    {
+        _ModifyProcAuraFlags(itr->ProcFlags, false);
+
+        // keep the indexes of a running walk valid, the cleared entry matches no proc flag
+        if (m_procAurasIterating)
+        {
+            itr->Application = nullptr;
+            itr->ProcFlags = 0;
+        }
+        else
+            m_procAuras.erase(itr);
+
+        return;
+    }
+
+    itr = std::find_if(m_pendingProcAuras.begin(), m_pendingProcAuras.end(), matches);
+    if (itr != m_pendingProcAuras.end())
+    {
+        _ModifyProcAuraFlags(itr->ProcFlags, false);
+        m_pendingProcAuras.erase(itr);
+    }
+}
+
+void Unit::_InsertProcAura(ProcAuraEntry const& entry)
+{
+    // insert after the auras with the same id to keep the m_appliedAuras (multimap) order
+    auto itr = std::upper_bound(m_procAuras.begin(), m_procAuras.end(), entry.SpellId, [](uint32 id, ProcAuraEntry const& other) { return id < other.SpellId; });
+    m_procAuras.insert(itr, entry);
+}
+
+void Unit::_ModifyProcAuraFlags(uint32 procFlags, bool apply)
+{
+    for (uint8 bit = 0; bit < m_procAuraFlagCounts.size(); ++bit)
+    {
+        uint32 flag = 1u << bit;
+        if (!(procFlags & flag))
+            continue;
+
+        if (apply)
+        {
+            if (!m_procAuraFlagCounts[bit]++)
+                m_procAuraFlagsMask |= flag;
+        }
+        else if (!--m_procAuraFlagCounts[bit])
+            m_procAuraFlagsMask &= ~flag;
+    }
+}
+
+// applies the changes made to m_procAuras while ProcDamageAndSpellFor was walking it
+void Unit::_FinishProcAurasIteration()
+{
+    if (--m_procAurasIterating)
+        return;
+
+    std::erase_if(m_procAuras, [](ProcAuraEntry const& entry) { return !entry.Application; });
+
+    for (ProcAuraEntry const& entry : m_pendingProcAuras)
+        _InsertProcAura(entry);
+
+    m_pendingProcAuras.clear();
+}
+
 // All aura base removes should go threw this function!
 void Unit::RemoveOwnedAura(AuraMap::iterator& i, AuraRemoveMode removeMode)
 {
@@ -6041,13 +6141,14 @@ uint32 Unit::GetDoTsByCaster(ObjectGuid casterGUID) const
     return dots;
 }
 
-int32 Unit::GetTotalAuraModifier(AuraType auraType, std::function<bool(AuraEffect const*)> const& predicate) const
+template<typename Predicate>
+int32 Unit::CalculateTotalAuraModifier(AuraType auraType, Predicate const& predicate) const
 {
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auraType);
     if (mTotalAuraList.empty())
         return 0;
 
-    std::map<SpellGroup, int32> sameEffectSpellGroup;
+    SameEffectSpellGroupAmounts sameEffectSpellGroup;
     int32 modifier = 0;
 
     for (AuraEffect const* aurEff : mTotalAuraList)
@@ -6068,13 +6169,14 @@ int32 Unit::GetTotalAuraModifier(AuraType auraType, std::function<bool(AuraEffec
     return modifier;
 }
 
-float Unit::GetTotalAuraMultiplier(AuraType auraType, std::function<bool(AuraEffect const*)> const& predicate) const
+template<typename Predicate>
+float Unit::CalculateTotalAuraMultiplier(AuraType auraType, Predicate const& predicate) const
 {
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auraType);
     if (mTotalAuraList.empty())
         return 1.0f;
 
-    std::map<SpellGroup, int32> sameEffectSpellGroup;
+    SameEffectSpellGroupAmounts sameEffectSpellGroup;
     float multiplier = 1.0f;
 
     for (AuraEffect const* aurEff : mTotalAuraList)
@@ -6089,12 +6191,22 @@ float Unit::GetTotalAuraMultiplier(AuraType auraType, std::function<bool(AuraEff
     }
 
     // Add the highest of the Same Effect Stack Rule SpellGroups to the multiplier
-    for (auto itr = sameEffectSpellGroup.begin(); itr != sameEffectSpellGroup.end(); ++itr)
-        AddPct(multiplier, itr->second);
+    for (auto const& [_, amount] : sameEffectSpellGroup)
+        AddPct(multiplier, amount);
 
     return multiplier;
 }
 
+int32 Unit::GetTotalAuraModifier(AuraType auraType, std::function<bool(AuraEffect const*)> const& predicate) const
+{
+    return CalculateTotalAuraModifier(auraType, predicate);
+}
+
+float Unit::GetTotalAuraMultiplier(AuraType auraType, std::function<bool(AuraEffect const*)> const& predicate) const
+{
+    return CalculateTotalAuraMultiplier(auraType, predicate);
+}
+
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auraType, std::function<bool(AuraEffect const*)> const& predicate) const
 {
     AuraEffectList const& mTotalAuraList = GetAuraEffectsByType(auraType);
@@ -6129,12 +6241,12 @@ int32 Unit::GetMaxNegativeAuraModifier(AuraType auraType, std::function<bool(Aur
 
 int32 Unit::GetTotalAuraModifier(AuraType auraType) const
 {
-    return GetTotalAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    return CalculateTotalAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
 }
 
 float Unit::GetTotalAuraMultiplier(AuraType auraType) const
 {
-    return GetTotalAuraMultiplier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    return CalculateTotalAuraMultiplier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
 }
 
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auraType) const
@@ -6149,7 +6261,7 @@ int32 Unit::GetMaxNegativeAuraModifier(AuraType auraType) const
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auraType, uint32 miscMask) const
 {
-    return GetTotalAuraModifier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+    return CalculateTotalAuraModifier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
     {
         if ((aurEff->GetMiscValue() & miscMask) != 0)
             return true;
@@ -6159,7 +6271,7 @@ int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auraType, uint32 miscMask) c
 
 float Unit::GetTotalAuraMultiplierByMiscMask(AuraType auraType, uint32 miscMask) const
 {
-    return GetTotalAuraMultiplier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
+    return CalculateTotalAuraMultiplier(auraType, [miscMask](AuraEffect const* aurEff) -> bool
     {
         if ((aurEff->GetMiscValue() & miscMask) != 0)
             return true;
@@ -6189,7 +6301,7 @@ int32 Unit::GetMaxNegativeAuraModifierByMiscMask(AuraType auraType, uint32 miscM
 
 int32 Unit::GetTotalAuraModifierByMiscValue(AuraType auraType, int32 miscValue) const
 {
-    return GetTotalAuraModifier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+    return CalculateTotalAuraModifier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
     {
         if (aurEff->GetMiscValue() == miscValue)
             return true;
@@ -6199,7 +6311,7 @@ int32 Unit::GetTotalAuraModifierByMiscValue(AuraType auraType, int32 miscValue)
 
 float Unit::GetTotalAuraMultiplierByMiscValue(AuraType auraType, int32 miscValue) const
 {
-    return GetTotalAuraMultiplier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
+    return CalculateTotalAuraMultiplier(auraType, [miscValue](AuraEffect const* aurEff) -> bool
     {
         if (aurEff->GetMiscValue() == miscValue)
             return true;
@@ -6229,7 +6341,7 @@ int32 Unit::GetMaxNegativeAuraModifierByMiscValue(AuraType auraType, int32 miscV
 
 int32 Unit::GetTotalAuraModifierByAffectMask(AuraType auraType, SpellInfo const* affectedSpell) const
 {
-    return GetTotalAuraModifier(auraType, [affectedSpell](AuraEffect const* aurEff) -> bool
+    return CalculateTotalAuraModifier(auraType, [affectedSpell](AuraEffect const* aurEff) -> bool
     {
         if (aurEff->IsAffectedOnSpell(affectedSpell))
             return true;
@@ -6239,7 +6351,7 @@ int32 Unit::GetTotalAuraModifierByAffectMask(AuraType auraType, SpellInfo const*
 
 float Unit::GetTotalAuraMultiplierByAffectMask(AuraType auraType, SpellInfo const* affectedSpell) const
 {
-    return GetTotalAuraMultiplier(auraType, [affectedSpell](AuraEffect const* aurEff) -> bool
+    return CalculateTotalAuraMultiplier(auraType, [affectedSpell](AuraEffect const* aurEff) -> bool
     {
         if (aurEff->IsAffectedOnSpell(affectedSpell))
             return true;
@@ -13922,6 +14034,11 @@ void Unit::SetInCombatState(bool PvP, Unit* enemy, uint32 duration)
 
     if (Creature* creature = ToCreature())
     {
+        // engaged (attacked, damaged or pulled by a script) while sleeping off the map update list,
+        // the combat timers start now so the time spent sleeping is not caught up on
+        if (creature->IsInWorld())
+            GetMap()->AddObjectToPendingUpdateList(creature, false);
+
         // Set home position at place of engaging combat for escorted creatures
         if ((IsAIEnabled && creature->AI()->IsEscorted()) ||
                 GetMotionMaster()->GetCurrentMovementGeneratorType() == WAYPOINT_MOTION_TYPE ||
@@ -16087,7 +16204,7 @@ struct ProcTriggeredData
     }
 };
 
-typedef std::list< ProcTriggeredData > ProcTriggeredList;
+typedef boost::container::small_vector<ProcTriggeredData, 8> ProcTriggeredList;
 
 // List of auras that CAN be trigger but may not exist in spell_proc_event
 // in most case need for drop charges
@@ -16379,25 +16496,34 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, procPhase, procExtra, procSpell, damageInfo, healInfo, procAura, procAuraEffectIndex);
 
+    if (isVictim)
+        procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
+
     ProcTriggeredList procTriggered;
-    // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
+    // Fill procTriggered list, only auras with matching proc flags can pass IsTriggeredAtSpellProcEvent
+    // the script and condition checks below may apply or remove auras, see _FinishProcAurasIteration
+    ++m_procAurasIterating;
+    for (std::size_t index = 0; index < m_procAuras.size() && (procFlag & m_procAuraFlagsMask); ++index)
     {
+        if (!(m_procAuras[index].ProcFlags & procFlag))
+            continue;
+
+        AuraApplication* aurApp = m_procAuras[index].Application;
+        uint32 spellId = m_procAuras[index].SpellId;
+
         // Do not allow auras to proc from effect triggered by itself
-        if (procAura && procAura->Id == itr->first)
+        if (procAura && procAura->Id == spellId)
             continue;
 
         // Xinef: Generic Item Equipment cooldown, -1 is a special marker
-        if (itr->second->GetBase()->GetCastItemGUID() && HasSpellItemCooldown(itr->first, uint32(-1)))
+        if (aurApp->GetBase()->GetCastItemGUID() && HasSpellItemCooldown(spellId, uint32(-1)))
             continue;
 
-        ProcTriggeredData triggerData(itr->second->GetBase());
+        ProcTriggeredData triggerData(aurApp->GetBase());
         // Defensive procs are active on absorbs (so absorption effects are not a hindrance)
         bool active = damage || (procExtra & PROC_EX_BLOCK && isVictim);
-        if (isVictim)
-            procExtra &= ~PROC_EX_INTERNAL_REQ_FAMILY;
 
-        SpellInfo const* spellProto = itr->second->GetBase()->GetSpellInfo();
+        SpellInfo const* spellProto = aurApp->GetBase()->GetSpellInfo();
 
         // only auras that have trigger spell should proc from fully absorbed damage
         if (procExtra & PROC_EX_ABSORB && isVictim)
@@ -16410,7 +16536,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
             active = true;
 
         // AuraScript Hook
-        if (!triggerData.aura->CallScriptCheckProcHandlers(itr->second, eventInfo))
+        if (!triggerData.aura->CallScriptCheckProcHandlers(aurApp, eventInfo))
         {
             continue;
         }
@@ -16418,7 +16544,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         bool isTriggeredAtSpellProcEvent = IsTriggeredAtSpellProcEvent(target, triggerData.aura, attType, isVictim, active, triggerData.spellProcEvent, eventInfo);
 
         // AuraScript Hook
-        if (!triggerData.aura->CallScriptAfterCheckProcHandlers(itr->second, eventInfo, isTriggeredAtSpellProcEvent))
+        if (!triggerData.aura->CallScriptAfterCheckProcHandlers(aurApp, eventInfo, isTriggeredAtSpellProcEvent))
         {
             continue;
         }
@@ -16434,9 +16560,9 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         bool hasTriggeredProc = false;
         for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
         {
-            if (itr->second->HasEffect(i))
+            if (aurApp->HasEffect(i))
             {
-                AuraEffect* aurEff = itr->second->GetBase()->GetEffect(i);
+                AuraEffect* aurEff = aurApp->GetBase()->GetEffect(i);
 
                 // Skip this auras
                 if (isNonTriggerAura[aurEff->GetAuraType()])
@@ -16491,15 +16617,16 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
                 if (!proccessed)
                 {
-                    procTriggered.push_front(triggerData);
+                    procTriggered.insert(procTriggered.begin(), triggerData);
                 }
             }
             else
             {
-                procTriggered.push_front(triggerData);
+                procTriggered.insert(procTriggered.begin(), triggerData);
             }
         }
     }
+    _FinishProcAurasIteration();
 
     // Nothing found
     if (procTriggered.empty())
@@ -19354,13 +19481,10 @@ void Unit::SetPhaseMask(uint32 newPhaseMask, bool update)
             // modify threat lists for new phasemask
             if (!IsPlayer())
             {
+                // copy, the state changes move references between the two lists
                 ThreatContainer::StorageType threatList = GetThreatMgr().GetThreatList();
-                ThreatContainer::StorageType offlineThreatList = GetThreatMgr().GetOfflineThreatList();
-
-                // merge expects sorted lists
-                threatList.sort();
-                offlineThreatList.sort();
-                threatList.merge(offlineThreatList);
+                ThreatContainer::StorageType const& offlineThreatList = GetThreatMgr().GetOfflineThreatList();
+                threatList.insert(threatList.end(), offlineThreatList.begin(), offlineThreatList.end());
 
                 for (ThreatContainer::StorageType::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
                     if (Unit* unit = (*itr)->getTarget())
@@ -19438,6 +19562,8 @@ void Unit::KnockbackFrom(float x, float y, float speedXY, float speedZ)
         float vcos, vsin;
         GetSinCos(x, y, vsin, vcos);
 
+        FlushQueuedMonsterMoves();
+
         WorldPacket data(SMSG_MOVE_KNOCK_BACK, (8 + 4 + 4 + 4 + 4 + 4));
         data << GetPackGUID();
         data << player->GetSession()->GetOrderCounter();        // movement counter
@@ -20023,6 +20149,11 @@ void Unit::SendTeleportPacket(Position& pos)
         Relocate(&oldPos);
     if (IsPlayer())
         Relocate(&pos);
+
+    // observers must not get a heartbeat from before the teleport after it
+    if (IsInWorld())
+        GetMap()->GetMovementHeartbeatBatch().Discard(GetGUID());
+
     SendMessageToSet(&data2, false);
 }
 
@@ -21162,16 +21293,7 @@ bool Unit::IsInCombatWith(Unit const* who) const
     if (!who)
         return false;
     // Search in threat list
-    ObjectGuid guid = who->GetGUID();
-    for (ThreatContainer::StorageType::const_iterator i = m_ThreatMgr.GetThreatList().begin(); i != m_ThreatMgr.GetThreatList().end(); ++i)
-    {
-        HostileReference* ref = (*i);
-        // Return true if the unit matches
-        if (ref && ref->getUnitGuid() == guid)
-            return true;
-    }
-    // Nothing found, false.
-    return false;
+    return m_ThreatMgr.IsThreatenedBy(who);
 }
 
 /**
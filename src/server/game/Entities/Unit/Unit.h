@@ -629,6 +629,14 @@ typedef std::unordered_map<uint32, uint32> PacketCooldowns;
 
 struct SpellProcEventEntry;                                 // used only privately
 
+// applied aura with the proc flags it reacts to in Unit::ProcDamageAndSpellFor
+struct ProcAuraEntry
+{
+    AuraApplication* Application;
+    uint32 SpellId;
+    uint32 ProcFlags;
+};
+
 enum class SpeedOpcodeIndex : uint32
 {
     PC,
@@ -1348,6 +1356,11 @@ public:
     void _ApplyAuraEffect(Aura* aura, uint8 effIndex);
     void _ApplyAura(AuraApplication* aurApp, uint8 effMask);
     void _UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMode);
+    void _AddProcAura(AuraApplication* aurApp);
+    void _RemoveProcAura(AuraApplication* aurApp);
+    void _InsertProcAura(ProcAuraEntry const& entry);
+    void _ModifyProcAuraFlags(uint32 procFlags, bool apply);
+    void _FinishProcAurasIteration();
     void _UnapplyAura(AuraApplication* aurApp, AuraRemoveMode removeMode);
     void _RemoveNoStackAuraApplicationsDueToAura(Aura* aura);
     void _RemoveNoStackAurasDueToAura(Aura* aura, bool owned);
@@ -2149,6 +2162,13 @@ protected:
 
     AuraMap m_ownedAuras;
     AuraApplicationMap m_appliedAuras;
+    // applied auras ProcDamageAndSpellFor can trigger, in m_appliedAuras order
+    // while ProcDamageAndSpellFor walks it, removed entries are only cleared and new ones wait in m_pendingProcAuras
+    std::vector<ProcAuraEntry> m_procAuras;
+    std::vector<ProcAuraEntry> m_pendingProcAuras;
+    uint32 m_procAurasIterating = 0;           // nesting depth of ProcDamageAndSpellFor walks over m_procAuras
+    std::array<uint16, 32> m_procAuraFlagCounts = {}; // number of proc auras per proc flag bit
+    uint32 m_procAuraFlagsMask = 0;            // union of m_procAuras proc flags
     AuraList m_removedAuras;
     AuraMap::iterator m_auraUpdateIterator;
     uint32 m_removedAurasCount;
@@ -2210,6 +2230,11 @@ private:
 
     [[nodiscard]] float processDummyAuras(float TakenTotalMod) const;
 
+    template<typename Predicate>
+    [[nodiscard]] int32 CalculateTotalAuraModifier(AuraType auraType, Predicate const& predicate) const;
+    template<typename Predicate>
+    [[nodiscard]] float CalculateTotalAuraMultiplier(AuraType auraType, Predicate const& predicate) const;
+
     void _addAttacker(Unit* pAttacker) { m_attackers.insert(pAttacker); }   ///@note: Call only in Unit::Attack()
     void _removeAttacker(Unit* pAttacker) { m_attackers.erase(pAttacker); } ///@note: Call only in Unit::AttackStop()
 
@@ -105,10 +105,11 @@ namespace Acore
         TeamId teamId;
         Player const* skipped_receiver;
         bool required3dDist;
+        PacketBroadcaster i_broadcaster;
         MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = nullptr, bool req3dDist = false)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
             , teamId((own_team_only && src->IsPlayer()) ? src->ToPlayer()->GetTeamId() : TEAM_NEUTRAL)
-            , skipped_receiver(skipped), required3dDist(req3dDist)
+            , skipped_receiver(skipped), required3dDist(req3dDist), i_broadcaster(msg)
         {
         }
         void Visit(VisiblePlayersMap const& m);
@@ -126,7 +127,7 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->SendDirectMessage(i_message);
+            i_broadcaster.SendTo(player);
         }
     };
 
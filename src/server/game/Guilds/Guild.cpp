@@ -2160,17 +2160,19 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const
 {
+    PacketBroadcaster broadcaster(packet);
     for (auto const& [guid, member] : m_members)
         if (member.IsRank(rankId))
             if (Player* player = member.FindPlayer())
-                player->SendDirectMessage(packet);
+                broadcaster.SendTo(player);
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
+    PacketBroadcaster broadcaster(packet);
     for (auto const& [guid, member] : m_members)
         if (Player* player = member.FindPlayer())
-            player->SendDirectMessage(packet);
+            broadcaster.SendTo(player);
 }
 
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
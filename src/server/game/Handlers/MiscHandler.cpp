@@ -285,20 +285,20 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
     data << uint32(matchCount);         // placeholder, count of players matching criteria
     data << uint32(displaycount);       // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList())
+    auto addTarget = [&](WhoListPlayerInfo const& target)
     {
         if (AccountMgr::IsPlayerAccount(security))
         {
             // player can see member of other team only if CONFIG_ALLOW_TWO_SIDE_WHO_LIST
             if (target.GetTeamId() != team && !allowTwoSideWhoList)
             {
-                continue;
+                return;
             }
 
             // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
             if (target.GetSecurity() > AccountTypes(gmLevelInWhoList))
             {
-                continue;
+                return;
             }
         }
 
@@ -306,60 +306,43 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
         if ((_player->GetGUID() != target.GetGuid() && !target.IsVisible()) &&
             (AccountMgr::IsPlayerAccount(_player->GetSession()->GetSecurity()) || target.GetSecurity() > _player->GetSession()->GetSecurity()))
         {
-            continue;
+            return;
         }
 
         // check if target's level is in level range
         uint8 lvl = target.GetLevel();
         if (lvl < levelMin || lvl > levelMax)
         {
-            continue;
+            return;
         }
 
         // check if class matches classmask
         uint8 class_ = target.GetClass();
         if (!(classmask & (1 << class_)))
         {
-            continue;
+            return;
         }
 
         // check if race matches racemask
         uint32 race = target.GetRace();
         if (!(racemask & (1 << race)))
         {
-            continue;
+            return;
         }
 
         uint32 playerZoneId = target.GetZoneId();
         uint8 gender = target.GetGender();
 
-        bool showZones = true;
-        for (uint32 i = 0; i < zonesCount; ++i)
-        {
-            if (zoneids[i] == playerZoneId)
-            {
-                showZones = true;
-                break;
-            }
-
-            showZones = false;
-        }
-
-        if (!showZones)
-        {
-            continue;
-        }
-
         std::wstring const& wideplayername = target.GetWidePlayerName();
         if (!(wpacketPlayerName.empty() || wideplayername.find(wpacketPlayerName) != std::wstring::npos))
         {
-            continue;
+            return;
         }
 
         std::wstring const& wideguildname = target.GetWideGuildName();
         if (!(wpacketGuildName.empty() || wideguildname.find(wpacketGuildName) != std::wstring::npos))
         {
-            continue;
+            return;
         }
 
         std::string aname;
@@ -387,14 +370,14 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
 
         if (!s_show)
         {
-            continue;
+            return;
         }
 
         // 49 is maximum player count sent to client - can be overridden
         // through config, but is unstable
         if ((matchCount++) >= sWorld->getIntConfig(CONFIG_MAX_WHO_LIST_RETURN))
         {
-            continue;
+            return;
         }
 
         data << target.GetPlayerName();                   // player name
@@ -406,6 +389,48 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
         data << uint32(playerZoneId);                     // player zone id
 
         ++displaycount;
+    };
+
+    // the cache is indexed by zone and level, only visit what the query can match
+    // the visited entries are put back in list order, so the CONFIG_MAX_WHO_LIST_RETURN cut off stays the same as without the index
+    WhoListInfoVector const& whoList = sWhoListCacheMgr->GetWhoList();
+    std::vector<uint32> candidates;
+
+    if (zonesCount)
+    {
+        for (uint32 i = 0; i < zonesCount; ++i)
+        {
+            // same zone sent twice
+            if (std::find(zoneids.begin(), zoneids.begin() + i, zoneids[i]) != zoneids.begin() + i)
+                continue;
+
+            if (std::vector<uint32> const* zonePlayers = sWhoListCacheMgr->GetWhoListByZone(zoneids[i]))
+                candidates.insert(candidates.end(), zonePlayers->begin(), zonePlayers->end());
+        }
+    }
+    else
+    {
+        for (uint32 level = levelMin; level <= std::min<uint32>(levelMax, STRONG_MAX_LEVEL); ++level)
+        {
+            if (!(sWhoListCacheMgr->GetClassMaskByLevel(level) & classmask) || !(sWhoListCacheMgr->GetRaceMaskByLevel(level) & racemask))
+                continue;
+
+            std::vector<uint32> const& levelPlayers = sWhoListCacheMgr->GetWhoListByLevel(level);
+            candidates.insert(candidates.end(), levelPlayers.begin(), levelPlayers.end());
+        }
+    }
+
+    // every entry can match, walk the list directly
+    if (candidates.size() == whoList.size())
+    {
+        for (WhoListPlayerInfo const& target : whoList)
+            addTarget(target);
+    }
+    else
+    {
+        std::sort(candidates.begin(), candidates.end());
+        for (uint32 index : candidates)
+            addTarget(whoList[index]);
     }
 
     data.put(0, displaycount);                            // insert right count, count displayed
@@ -392,6 +392,24 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
     /* process position-change */
     WorldPacket data(opcode, recvData.size());
     WriteMovementInfo(&data, &movementInfo);
+    SendMovementToObservers(mover, data);
+}
+
+void WorldSession::SendMovementToObservers(Unit* mover, WorldPacket& data)
+{
+    if (sWorld->getBoolConfig(CONFIG_MAP_UPDATE_COALESCE_MOVEMENT))
+    {
+        MovementHeartbeatBatch& heartbeats = mover->GetMap()->GetMovementHeartbeatBatch();
+        if (data.GetOpcode() == MSG_MOVE_HEARTBEAT)
+        {
+            heartbeats.Queue(mover, _player, std::move(data), _movementHeartbeatCount++);
+            return;
+        }
+
+        // a newer movement state supersedes the heartbeat still waiting for the end of the map update
+        heartbeats.Discard(mover->GetGUID());
+    }
+
     mover->SendMessageToSet(&data, _player);
 }
 
@@ -703,7 +721,7 @@ void WorldSession::HandleForceSpeedChangeAck(WorldPacket& recvData)
         WorldPacket data(MSG_MOVE_SET_COLLISION_HGT, 18);
         WriteMovementInfo(&data, &movementInfo);
         data << newspeed; // new collision height
-        mover->SendMessageToSet(&data, _player);
+        SendMovementToObservers(mover, data);
         return;
     }
 
@@ -736,7 +754,7 @@ void WorldSession::HandleForceSpeedChangeAck(WorldPacket& recvData)
     WorldPacket data(speedOpcodes[static_cast<size_t>(SpeedOpcodeIndex::ACK_RESPONSE)], 18);
     WriteMovementInfo(&data, &movementInfo);
     data << newspeed;
-    mover->SendMessageToSet(&data, _player);
+    SendMovementToObservers(mover, data);
 
     // skip all forced speed changes except last and unexpected
     // in run/mounted case used one ACK and it must be skipped.m_forced_speed_changes[MOVE_RUN} store both.
@@ -845,6 +863,7 @@ void WorldSession::HandleMoveKnockBackAck(WorldPacket& recvData)
     data << movementInfo.jump.xyspeed;
     data << movementInfo.jump.zspeed;
 
+    _player->GetMap()->GetMovementHeartbeatBatch().Discard(_player->GetGUID());
     _player->SendMessageToSet(&data, false);
 }
 
@@ -1016,5 +1035,5 @@ void WorldSession::HandleMoveRootAck(WorldPacket& recvData)
 
     WorldPacket data(opcode == CMSG_FORCE_MOVE_UNROOT_ACK ? MSG_MOVE_UNROOT : MSG_MOVE_ROOT);
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+    SendMovementToObservers(mover, data);
 }
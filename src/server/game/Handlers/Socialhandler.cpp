@@ -128,6 +128,8 @@ void WorldSession::HandleAddIgnoreOpcode(WorldPacket& recv_data)
         // ignore list full
         if (!GetPlayer()->GetSocial()->AddToSocialList(ignoreGuid, SOCIAL_FLAG_IGNORED))
             ignoreResult = FRIEND_IGNORE_FULL;
+        else
+            GetPlayer()->AddChannelIgnoreFilter(ignoreGuid);
     }
 
     sSocialMgr->SendFriendStatus(GetPlayer(), ignoreResult, ignoreGuid, false);
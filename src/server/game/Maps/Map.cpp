@@ -47,6 +47,9 @@
 
 #define MAP_INVALID_ZONE        0xFFFFFFFF
 
+// source of the line of sight cache generations of all maps
+static std::atomic<uint64> LineOfSightCacheGenerations{0};
+
 ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), DefaultWeather(nullptr), WeatherId(WEATHER_STATE_FINE),
                                      WeatherGrade(0.0f), OverrideLightId(0), LightFadeInTime(0) { }
 
@@ -75,6 +78,11 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
 
     _zonePlayerCountMap.clear();
     _updatableObjectListRecheckTimer.SetInterval(UPDATABLE_OBJECT_LIST_RECHECK_TIMER);
+    _updateLodCreatureCount.fill(0);
+    _updateLodTick = 0;
+    _lineOfSightCacheGeneration = ++LineOfSightCacheGenerations;
+    _lineOfSightCacheHits = 0;
+    _lineOfSightCacheMisses = 0;
 
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
@@ -431,6 +439,8 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
+    ResetLineOfSightCache(t_diff != 0);
+
     if (t_diff)
         _dynamicTree.update(t_diff);
 
@@ -462,6 +472,9 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     _updatableObjectListRecheckTimer.Update(t_diff);
     resetMarkedCells();
 
+    bool updateLod = sWorld->getBoolConfig(CONFIG_MAP_UPDATE_LOD_ENABLE);
+    _updateLodObservers.clear();
+
     // Update players
     for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
     {
@@ -472,6 +485,13 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
         player->Update(s_diff);
 
+        if (updateLod && player->IsInWorld() && !player->GetSession()->IsBot())
+        {
+            _updateLodObservers.push_back(player);
+            if (WorldObject* viewPoint = player->GetViewpoint())
+                _updateLodObservers.push_back(viewPoint);
+        }
+
         if (_updatableObjectListRecheckTimer.Passed())
         {
             MarkNearbyCellsOf(player);
@@ -489,7 +509,25 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     UpdateNonPlayerObjects(t_diff);
 
+    sScriptMgr->OnMapObjectsUpdated(this, t_diff);
+
+    if (updateLod)
+    {
+        ++_updateLodTick;
+        for (uint8 level = 0; level <= MAX_UPDATE_LOD_LEVEL; ++level)
+        {
+            METRIC_VALUE("map_creatures_lod", uint64(_updateLodCreatureCount[level]),
+                METRIC_TAG("map_id", std::to_string(GetId())),
+                METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())),
+                METRIC_TAG("lod_level", std::to_string(level)));
+        }
+
+        _updateLodCreatureCount.fill(0);
+    }
+
     SendObjectUpdates();
+    _monsterMoveBatch.Flush(this);
+    _movementHeartbeatBatch.Flush(this);
 
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
@@ -521,10 +559,37 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
 void Map::UpdateNonPlayerObjects(uint32 const diff)
 {
+    // objects woken up from sleeping first catch up on the time they spent off the update list
+    std::vector<std::pair<WorldObject*, uint32>> wokenObjects;
+    Milliseconds now = GameTime::GetGameTimeMS();
+    while (!_sleepingCreatureWakeTimes.empty() && _sleepingCreatureWakeTimes.begin()->first <= now)
+    {
+        if (Creature* creature = GetCreature(_sleepingCreatureWakeTimes.begin()->second))
+            AddObjectToPendingUpdateList(creature);
+
+        _sleepingCreatureWakeTimes.erase(_sleepingCreatureWakeTimes.begin());
+    }
+
     for (WorldObject* obj : _pendingAddUpdatableObjectList)
+    {
         _AddObjectToUpdateList(obj);
+
+        UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
+        if (Milliseconds parkedTime = mapUpdatableObject->GetMapUpdateParkedTime(); parkedTime > 0ms)
+        {
+            mapUpdatableObject->SetMapUpdateParkedTime(0ms);
+            uint32 slept = uint32((now - parkedTime).count());
+            if (slept > diff)
+                wokenObjects.emplace_back(obj, slept - diff);
+        }
+    }
     _pendingAddUpdatableObjectList.clear();
 
+    for (auto const& [obj, slept] : wokenObjects)
+        if (obj->IsInWorld())
+            obj->Update(slept);
+
+    bool updateLod = sWorld->getBoolConfig(CONFIG_MAP_UPDATE_LOD_ENABLE);
     if (_updatableObjectListRecheckTimer.Passed())
     {
         for (uint32 i = 0; i < _updatableObjectList.size();)
@@ -536,11 +601,20 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
                 continue;
             }
 
-            obj->Update(diff);
+            // creatures skipped by the level of detail still go through the parking check, the
+            // distant ones are the most likely to be parked and keep their deferred diff meanwhile
+            uint32 updateDiff = diff;
+            Creature* creature = obj->ToCreature();
+            if (!creature || !updateLod || CanUpdateWithLod(creature, diff, updateDiff))
+                obj->Update(updateDiff);
 
             if (!obj->IsUpdateNeeded())
             {
                 _RemoveObjectFromUpdateList(obj);
+                dynamic_cast<UpdatableMapObject*>(obj)->SetMapUpdateParkedTime(now);
+                // events past the parking horizon don't keep the creature awake, come back for the next one
+                if (creature && creature->m_Events.HasEvents())
+                    _sleepingCreatureWakeTimes.emplace(now + Milliseconds(creature->m_Events.GetTimeToNextEvent()), creature->GetGUID());
                 // Intentional no iteration here, obj is swapped with last element in
                 // _updatableObjectList so next loop will update that object at the same index
             }
@@ -557,17 +631,65 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
             if (!obj->IsInWorld())
                 continue;
 
-            obj->Update(diff);
+            uint32 updateDiff = diff;
+            Creature* creature = obj->ToCreature();
+            if (creature && updateLod && !CanUpdateWithLod(creature, diff, updateDiff))
+                continue;
+
+            obj->Update(updateDiff);
         }
     }
 }
 
-void Map::AddObjectToPendingUpdateList(WorldObject* obj)
+// Returns false when the creature skips this tick, otherwise sets the diff to update it with
+bool Map::CanUpdateWithLod(Creature* creature, uint32 diff, uint32& updateDiff)
+{
+    // anything a player may be interacting with updates every tick
+    if (creature->IsInCombat() || !creature->movespline->Finalized() || creature->isActiveObject() || creature->GetCharmerOrOwnerGUID().IsPlayer())
+        creature->SetUpdateLodLevel(0);
+    else if (uint32 mask = (1 << creature->GetUpdateLodLevel()) - 1; (_updateLodTick + creature->GetGUID().GetCounter()) & mask)
+    {
+        // spread over the ticks by guid, so a level does not update all at once
+        ++_updateLodCreatureCount[creature->GetUpdateLodLevel()];
+        creature->DeferUpdateLodDiff(diff);
+        return false;
+    }
+    else
+        creature->SetUpdateLodLevel(GetUpdateLodLevel(creature));
+
+    ++_updateLodCreatureCount[creature->GetUpdateLodLevel()];
+    updateDiff = creature->TakeUpdateLodDiff(diff);
+    return true;
+}
+
+uint8 Map::GetUpdateLodLevel(Creature const* creature) const
+{
+    uint8 maxLevel = std::min<uint8>(sWorld->getIntConfig(CONFIG_MAP_UPDATE_LOD_MAX_LEVEL), MAX_UPDATE_LOD_LEVEL);
+
+    float minDistSq = std::numeric_limits<float>::max();
+    for (WorldObject const* observer : _updateLodObservers)
+        minDistSq = std::min(minDistSq, creature->GetExactDist2dSq(observer));
+
+    uint8 level = 0;
+    float distance = sWorld->getFloatConfig(CONFIG_MAP_UPDATE_LOD_DISTANCE);
+    while (level < maxLevel && minDistSq >= distance * distance)
+    {
+        ++level;
+        distance *= 2.0f;
+    }
+
+    return level;
+}
+
+void Map::AddObjectToPendingUpdateList(WorldObject* obj, bool catchUp /*= true*/)
 {
     if (!obj->CanBeAddedToMapUpdateList())
         return;
 
     UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
+    if (!catchUp)
+        mapUpdatableObject->SetMapUpdateParkedTime(0ms);
+
     if (mapUpdatableObject->GetUpdateState() != UpdatableMapObject::UpdateState::NotUpdating)
         return;
 
@@ -608,6 +730,7 @@ void Map::RemoveObjectFromMapUpdateList(WorldObject* obj)
         return;
 
     UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
+    mapUpdatableObject->SetMapUpdateParkedTime(0ms);
     if (mapUpdatableObject->GetUpdateState() == UpdatableMapObject::UpdateState::PendingAdd)
         _pendingAddUpdatableObjectList.erase(obj);
     else if (mapUpdatableObject->GetUpdateState() == UpdatableMapObject::UpdateState::Updating)
@@ -1530,6 +1653,78 @@ float Map::GetWaterLevel(float x, float y) const
 }
 
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    if (!sWorld->getBoolConfig(CONFIG_MAP_LOS_CACHE))
+        return isInLineOfSightUncached(x1, y1, z1, x2, y2, z2, phasemask, checks, ignoreFlags);
+
+    // AI, spell and playerbot checks ask for the same pairs many times during one update. Every thread
+    // keeps the results of the map generation it looked at last, so lookups never take a lock
+    struct LineOfSightCache
+    {
+        uint64 Generation = 0;
+        std::unordered_map<LineOfSightCacheKey, bool, LineOfSightCacheKeyHash> Results;
+    };
+
+    thread_local LineOfSightCache cache;
+
+    uint64 generation = _lineOfSightCacheGeneration.load(std::memory_order_acquire);
+    if (cache.Generation != generation)
+    {
+        cache.Results.clear();
+        cache.Generation = generation;
+    }
+
+    LineOfSightCacheKey key{ { x1, y1, z1, x2, y2, z2 }, phasemask, uint32(checks) | (uint32(ignoreFlags) << 8) };
+    auto itr = cache.Results.find(key);
+    if (itr != cache.Results.end())
+    {
+        _lineOfSightCacheHits.fetch_add(1, std::memory_order_relaxed);
+        return itr->second;
+    }
+
+    bool result = isInLineOfSightUncached(x1, y1, z1, x2, y2, z2, phasemask, checks, ignoreFlags);
+    _lineOfSightCacheMisses.fetch_add(1, std::memory_order_relaxed);
+    cache.Results.emplace(key, result);
+    return result;
+}
+
+// Nearby end points share a hash bucket, the key itself compares them exactly. Rounding also
+// hashes 0.0 and -0.0, which compare equal, the same.
+std::size_t Map::LineOfSightCacheKeyHash::operator()(LineOfSightCacheKey const& key) const
+{
+    std::size_t hash = key.PhaseMask ^ (std::size_t(key.Flags) << 32);
+    for (float coord : key.Coords)
+        hash = hash * 1099511628211ULL ^ uint32(int32(std::lround(coord * LINEOFSIGHT_CACHE_PRECISION)));
+    return hash;
+}
+
+void Map::InvalidateLineOfSightCache()
+{
+    // generations are unique over all maps, so a thread cache never mistakes another map's results for this one's
+    _lineOfSightCacheGeneration.store(++LineOfSightCacheGenerations, std::memory_order_release);
+}
+
+void Map::ResetLineOfSightCache(bool reportMetrics)
+{
+    if (reportMetrics)
+    {
+        uint32 hits = _lineOfSightCacheHits.exchange(0, std::memory_order_relaxed);
+        uint32 misses = _lineOfSightCacheMisses.exchange(0, std::memory_order_relaxed);
+        if (hits || misses)
+        {
+            METRIC_VALUE("map_los_cache_hits", uint64(hits),
+                METRIC_TAG("map_id", std::to_string(GetId())),
+                METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+            METRIC_VALUE("map_los_cache_misses", uint64(misses),
+                METRIC_TAG("map_id", std::to_string(GetId())),
+                METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+        }
+    }
+
+    InvalidateLineOfSightCache();
+}
+
+bool Map::isInLineOfSightUncached(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
     if (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_PVP_LOS))
     {
@@ -1719,20 +1914,25 @@ void Map::SendObjectUpdates()
         obj->BuildUpdate(update_players);
     }
 
+    uint32 discarded = 0;
     WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
-        if (!sScriptMgr->OnPlayerbotCheckUpdatesToSend(iter->first))
+        if (iter->second.IsDiscarded())
         {
-            iter->second.Clear();
+            ++discarded;
             continue;
         }
 
-
         iter->second.BuildPacket(packet);
         iter->first->SendDirectMessage(&packet);
         packet.clear();                                     // clean the string
     }
+
+    if (discarded)
+        METRIC_VALUE("map_update_receivers_discarded", uint64(discarded),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
 }
 
 uint32 Map::ApplyDynamicModeRespawnScaling(WorldObject const* obj, uint32 respawnDelay) const
@@ -1849,8 +2049,9 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    PacketBroadcaster broadcaster(data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->SendDirectMessage(data);
+        broadcaster.SendTo(itr->GetSource());
 }
 
 template bool Map::AddToMap(Corpse*, bool);
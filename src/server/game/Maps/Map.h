@@ -29,6 +29,8 @@
 #include "GridRefMgr.h"
 #include "MapGridManager.h"
 #include "MapRefMgr.h"
+#include "MonsterMoveBatch.h"
+#include "MovementHeartbeatBatch.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
 #include "PathGenerator.h"
@@ -36,8 +38,11 @@
 #include "SharedDefines.h"
 #include "Timer.h"
 #include "GridTerrainData.h"
+#include <array>
+#include <atomic>
 #include <bitset>
 #include <list>
+#include <map>
 #include <memory>
 #include <shared_mutex>
 
@@ -89,6 +94,7 @@ struct ScriptAction
 #define DEFAULT_HEIGHT_SEARCH     50.0f                     // default search distance to find height at nearby locations
 #define MIN_UNLOAD_DELAY      1                             // immediate unload
 #define UPDATABLE_OBJECT_LIST_RECHECK_TIMER 30 * IN_MILLISECONDS // Time to recheck update object list
+#define MAX_UPDATE_LOD_LEVEL 4 // Creatures far from players update at least every 2^MAX_UPDATE_LOD_LEVEL ticks
 
 struct PositionFullTerrainStatus
 {
@@ -99,6 +105,9 @@ struct PositionFullTerrainStatus
     LiquidData liquidInfo;
 };
 
+// line of sight cache entries are hashed on the end points rounded to 1/LINEOFSIGHT_CACHE_PRECISION yards
+#define LINEOFSIGHT_CACHE_PRECISION 8.0f
+
 enum LineOfSightChecks
 {
     LINEOFSIGHT_CHECK_VMAP          = 0x1, // check static floor layout data
@@ -388,8 +397,9 @@ public:
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CheckCollisionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true) const;
     void Balance() { _dynamicTree.balance(); }
-    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
+    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); InvalidateLineOfSightCache(); }
+    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); InvalidateLineOfSightCache(); }
+    void InvalidateLineOfSightCache();
     [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _dynamicTree; }
     bool GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
@@ -495,6 +505,11 @@ public:
 
     size_t GetUpdatableObjectsCount() const { return _updatableObjectList.size(); }
 
+    // monster moves launched during the update, sent after object updates when MapUpdate.BatchMonsterMoves is enabled
+    Movement::MonsterMoveBatch& GetMonsterMoveBatch() { return _monsterMoveBatch; }
+    // client movement heartbeats rebroadcast after the update when MapUpdate.CoalesceMovement is enabled
+    MovementHeartbeatBatch& GetMovementHeartbeatBatch() { return _movementHeartbeatBatch; }
+
     virtual std::string GetDebugInfo() const;
 
     uint32 GetCreatedGridsCount();
@@ -502,7 +517,9 @@ public:
     uint32 GetCreatedCellsInGridCount(uint16 const x, uint16 const y);
     uint32 GetCreatedCellsInMapCount();
 
-    void AddObjectToPendingUpdateList(WorldObject* obj);
+    // catchUp false skips the catch-up update over the time the object slept, for wakes that change what it is
+    // doing (entering combat, respawning) where running the parked time through the new state would be wrong
+    void AddObjectToPendingUpdateList(WorldObject* obj, bool catchUp = true);
     void RemoveObjectFromMapUpdateList(WorldObject* obj);
 
     typedef std::vector<WorldObject*> UpdatableObjectList;
@@ -592,6 +609,8 @@ private:
     void DeleteFromWorld(T*);
 
     void UpdateNonPlayerObjects(uint32 const diff);
+    bool CanUpdateWithLod(Creature* creature, uint32 diff, uint32& updateDiff);
+    [[nodiscard]] uint8 GetUpdateLodLevel(Creature const* creature) const;
 
     void _AddObjectToUpdateList(WorldObject* obj);
     void _RemoveObjectFromUpdateList(WorldObject* obj);
@@ -630,7 +649,39 @@ private:
     UpdatableObjectList _updatableObjectList;
     PendingAddUpdatableObjectList _pendingAddUpdatableObjectList;
     IntervalTimer _updatableObjectListRecheckTimer;
+    std::multimap<Milliseconds, ObjectGuid> _sleepingCreatureWakeTimes; // creatures parked with delayed events, by game time of the next one
     ZoneWideVisibleWorldObjectsMap _zoneWideVisibleWorldObjectsMap;
+
+    // level of detail: real players (and their viewpoints) that creatures measure their update rate against
+    std::vector<WorldObject const*> _updateLodObservers;
+    std::array<uint32, MAX_UPDATE_LOD_LEVEL + 1> _updateLodCreatureCount;
+    uint32 _updateLodTick;
+
+    Movement::MonsterMoveBatch _monsterMoveBatch;
+    MovementHeartbeatBatch _movementHeartbeatBatch;
+
+    // line of sight results of the current update, keyed on the exact end points
+    struct LineOfSightCacheKey
+    {
+        std::array<float, 6> Coords;
+        uint32 PhaseMask;
+        uint32 Flags;
+
+        bool operator==(LineOfSightCacheKey const& right) const = default;
+    };
+
+    struct LineOfSightCacheKeyHash
+    {
+        std::size_t operator()(LineOfSightCacheKey const& key) const;
+    };
+
+    [[nodiscard]] bool isInLineOfSightUncached(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    void ResetLineOfSightCache(bool reportMetrics);
+
+    // the results live in a cache per thread, changing the generation drops them everywhere
+    std::atomic<uint64> _lineOfSightCacheGeneration;
+    mutable std::atomic<uint32> _lineOfSightCacheHits;
+    mutable std::atomic<uint32> _lineOfSightCacheMisses;
 };
 
 enum InstanceResetMethod
@@ -16,6 +16,7 @@
  */
 
 #include "MapUpdater.h"
+#include "BattlegroundQueue.h"
 #include "DatabaseEnv.h"
 #include "LFGMgr.h"
 #include "Log.h"
@@ -90,6 +91,24 @@ private:
     uint32 m_diff;
 };
 
+class ArenaQueueSearchRequest : public UpdateRequest
+{
+public:
+    ArenaQueueSearchRequest(BattlegroundQueue& queue, BattlegroundBracketId bracketId, RatedArenaMatch& match, MapUpdater& u)
+        : m_queue(queue), m_bracketId(bracketId), m_match(match), m_updater(u) {}
+
+    void call() override
+    {
+        m_queue.FindRatedArenaMatch(m_bracketId, 0, m_match);
+        m_updater.update_finished();
+    }
+private:
+    BattlegroundQueue& m_queue;
+    BattlegroundBracketId m_bracketId;
+    RatedArenaMatch& m_match;
+    MapUpdater& m_updater;
+};
+
 MapUpdater::MapUpdater() : pending_requests(0), _cancelationToken(false)
 {
 }
@@ -153,6 +172,11 @@ void MapUpdater::schedule_lfg_update(uint32 diff)
     schedule_task(new LFGUpdateRequest(*this, diff));
 }
 
+void MapUpdater::schedule_arena_queue_search(BattlegroundQueue& queue, BattlegroundBracketId bracketId, RatedArenaMatch& match)
+{
+    schedule_task(new ArenaQueueSearchRequest(queue, bracketId, match, *this));
+}
+
 bool MapUpdater::activated()
 {
     return !_workerThreads.empty();
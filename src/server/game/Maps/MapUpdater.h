@@ -24,8 +24,11 @@
 #include <thread>
 #include <atomic>
 
+class BattlegroundQueue;
 class Map;
 class UpdateRequest;
+struct RatedArenaMatch;
+enum BattlegroundBracketId : uint8;
 
 class MapUpdater
 {
@@ -37,6 +40,7 @@ public:
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_map_preload(uint32 mapid);
     void schedule_lfg_update(uint32 diff);
+    void schedule_arena_queue_search(BattlegroundQueue& queue, BattlegroundBracketId bracketId, RatedArenaMatch& match);
     void wait();
     void activate(std::size_t num_threads);
     void deactivate();
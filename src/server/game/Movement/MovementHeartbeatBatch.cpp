@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MovementHeartbeatBatch.h"
+#include "Map.h"
+#include "Metric.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "World.h"
+
+void MovementHeartbeatBatch::Queue(Unit const* mover, Player const* skipped, WorldPacket&& packet, uint32 heartbeatIndex)
+{
+    PendingHeartbeat& heartbeat = _heartbeats[mover->GetGUID()];
+    heartbeat.Packet = std::make_shared<WorldPacket const>(std::move(packet));
+    heartbeat.Skipped = skipped ? skipped->GetGUID() : ObjectGuid::Empty;
+    heartbeat.HeartbeatIndex = heartbeatIndex;
+}
+
+void MovementHeartbeatBatch::Flush(Map* map)
+{
+    if (_heartbeats.empty())
+        return;
+
+    float distance = sWorld->getFloatConfig(CONFIG_MAP_UPDATE_COALESCE_MOVEMENT_DISTANCE);
+    uint32 maxLevel = sWorld->getIntConfig(CONFIG_MAP_UPDATE_COALESCE_MOVEMENT_MAX_LEVEL);
+    uint32 sent = 0;
+    uint32 skipped = 0;
+
+    for (auto const& [guid, heartbeat] : _heartbeats)
+    {
+        Unit* mover = guid.IsPlayer() ? static_cast<Unit*>(ObjectAccessor::GetPlayer(map, guid)) : map->GetCreature(guid);
+        if (!mover || !mover->IsInWorld())
+            continue;
+
+        // same receivers as Unit::SendMessageToSet(data, skipped) would have reached
+        if (Player* player = mover->ToPlayer(); player && player->GetGUID() != heartbeat.Skipped)
+            player->SendDirectMessage(heartbeat.Packet);
+
+        for (auto const& [receiverGuid, receiver] : mover->GetObjectVisibilityContainer().GetVisiblePlayersMap())
+        {
+            if (receiverGuid == heartbeat.Skipped)
+                continue;
+
+            uint32 level = 0;
+            float distSq = receiver->m_seer->GetExactDist2dSq(mover);
+            for (float limit = distance; level < maxLevel && distSq >= limit * limit; limit *= 2.0f)
+                ++level;
+
+            if (heartbeat.HeartbeatIndex & ((1 << level) - 1))
+            {
+                ++skipped;
+                continue;
+            }
+
+            receiver->SendDirectMessage(heartbeat.Packet);
+            ++sent;
+        }
+    }
+
+    _heartbeats.clear();
+
+    METRIC_VALUE("map_movement_heartbeats_sent", uint64(sent),
+        METRIC_TAG("map_id", std::to_string(map->GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(map->GetInstanceId())));
+    METRIC_VALUE("map_movement_heartbeats_skipped", uint64(skipped),
+        METRIC_TAG("map_id", std::to_string(map->GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(map->GetInstanceId())));
+}
@@ -0,0 +1,50 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AC_MOVEMENT_HEARTBEAT_BATCH_H
+#define AC_MOVEMENT_HEARTBEAT_BATCH_H
+
+#include "ObjectGuid.h"
+#include "WorldPacket.h"
+#include <unordered_map>
+
+class Map;
+class Player;
+class Unit;
+
+// Client movement heartbeats (MSG_MOVE_HEARTBEAT) received during a map update. The relocation is
+// applied right away, only the rebroadcast waits for the end of the update: every mover sends its
+// latest heartbeat once, and observers further away receive only every 2nd, 4th... heartbeat.
+class MovementHeartbeatBatch
+{
+public:
+    void Queue(Unit const* mover, Player const* skipped, WorldPacket&& packet, uint32 heartbeatIndex);
+    void Discard(ObjectGuid mover) { if (!_heartbeats.empty()) _heartbeats.erase(mover); }
+    void Flush(Map* map);
+
+private:
+    struct PendingHeartbeat
+    {
+        SharedWorldPacket Packet;
+        ObjectGuid Skipped;
+        uint32 HeartbeatIndex;
+    };
+
+    std::unordered_map<ObjectGuid, PendingHeartbeat> _heartbeats;
+};
+
+#endif // AC_MOVEMENT_HEARTBEAT_BATCH_H
@@ -0,0 +1,194 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MonsterMoveBatch.h"
+#include "Map.h"
+#include "Metric.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "WorldSession.h"
+#include "WorldSocket.h"
+#include "zlib.h"
+#include <algorithm>
+#include <map>
+
+namespace Movement
+{
+    // SMSG_COMPRESSED_MOVES stores every packet as uint8 size (opcode included), uint16 opcode, payload
+    static constexpr std::size_t MaxCompressedMovePayload = 0xFF - sizeof(uint16);
+
+    // server header of a packet sent on its own
+    static constexpr std::size_t ServerPacketHeaderSize = 4;
+
+    void MonsterMoveBatch::Queue(Unit const* mover, WorldPacket&& packet)
+    {
+        _moves.push_back({ mover->GetGUID(), std::make_shared<WorldPacket const>(std::move(packet)) });
+        _movers.insert(mover->GetGUID());
+    }
+
+    void MonsterMoveBatch::FlushMover(WorldObject const* mover)
+    {
+        if (_movers.empty() || !_movers.erase(mover->GetGUID()))
+            return;
+
+        std::vector<SharedWorldPacket> packets;
+        std::erase_if(_moves, [&](QueuedMove& move)
+        {
+            if (move.Mover != mover->GetGUID())
+                return false;
+
+            packets.push_back(std::move(move.Packet));
+            return true;
+        });
+
+        // same receivers as the batched send, just without merging
+        for (SharedWorldPacket const& packet : packets)
+            mover->SendMessageToSet(packet.get(), true);
+    }
+
+    void MonsterMoveBatch::Flush(Map* map)
+    {
+        if (_moves.empty())
+            return;
+
+        std::vector<QueuedMove> moves;
+        moves.swap(_moves);
+        _movers.clear();
+
+        // same receivers as Unit::SendMessageToSet(data, true) would have reached
+        std::vector<std::pair<Player*, uint32>> deliveries;
+        for (uint32 i = 0; i < moves.size(); ++i)
+        {
+            Unit* mover = moves[i].Mover.IsPlayer() ? static_cast<Unit*>(ObjectAccessor::GetPlayer(map, moves[i].Mover)) : map->GetCreature(moves[i].Mover);
+            if (!mover || !mover->IsInWorld())
+                continue;
+
+            float distSq = 0.0f;
+            if (Player* player = mover->ToPlayer())
+            {
+                deliveries.emplace_back(player, i);
+                distSq = player->GetVisibilityRange() * player->GetVisibilityRange();
+            }
+
+            for (auto const& [guid, player] : mover->GetObjectVisibilityContainer().GetVisiblePlayersMap())
+            {
+                if (distSq != 0.0f && player->m_seer->GetExactDist2dSq(mover) > distSq)
+                    continue;
+
+                deliveries.emplace_back(player, i);
+            }
+        }
+
+        std::stable_sort(deliveries.begin(), deliveries.end(), [](auto const& left, auto const& right) { return left.first < right.first; });
+
+        // clients that receive the same run of moves get the same compressed packet
+        std::map<std::vector<uint32>, SharedWorldPacket> compressedMoves;
+        int64 bytesSaved = 0;
+
+        auto sendRun = [&](Player* player, std::vector<uint32> const& run)
+        {
+            if (run.size() < 2)
+            {
+                for (uint32 index : run)
+                    player->SendDirectMessage(moves[index].Packet);
+                return;
+            }
+
+            auto itr = compressedMoves.find(run);
+            if (itr == compressedMoves.end())
+            {
+                ByteBuffer buffer;
+                std::size_t separateSize = 0;
+                for (uint32 index : run)
+                {
+                    WorldPacket const& packet = *moves[index].Packet;
+                    buffer << uint8(packet.size() + sizeof(uint16));
+                    buffer << uint16(packet.GetOpcode());
+                    buffer.append(packet.contents(), packet.size());
+                    separateSize += packet.size() + ServerPacketHeaderSize;
+                }
+
+                uint32 destSize = compressBound(buffer.size());
+                WorldPacket compressed(SMSG_COMPRESSED_MOVES, destSize + sizeof(uint32));
+                compressed.resize(destSize + sizeof(uint32));
+                compressed.put<uint32>(0, buffer.size());
+                compressBuff(const_cast<uint8*>(compressed.contents()) + sizeof(uint32), &destSize, const_cast<uint8*>(buffer.contents()), buffer.size());
+
+                SharedWorldPacket shared;
+                if (destSize && destSize + sizeof(uint32) + ServerPacketHeaderSize < separateSize)
+                {
+                    compressed.resize(destSize + sizeof(uint32));
+                    shared = std::make_shared<WorldPacket const>(std::move(compressed));
+                }
+
+                itr = compressedMoves.emplace(run, std::move(shared)).first;
+            }
+
+            if (!itr->second)
+            {
+                for (uint32 index : run)
+                    player->SendDirectMessage(moves[index].Packet);
+                return;
+            }
+
+            for (uint32 index : run)
+                bytesSaved += moves[index].Packet->size() + ServerPacketHeaderSize;
+            bytesSaved -= itr->second->size() + ServerPacketHeaderSize;
+
+            player->SendDirectMessage(itr->second);
+        };
+
+        std::vector<uint32> run;
+        for (auto itr = deliveries.begin(); itr != deliveries.end();)
+        {
+            Player* player = itr->first;
+            auto end = std::find_if(itr, deliveries.end(), [player](auto const& delivery) { return delivery.first != player; });
+
+            // bots read the plain packets and a single move gains nothing from merging
+            if (player->GetSession()->IsBot() || std::distance(itr, end) < 2)
+            {
+                for (; itr != end; ++itr)
+                    player->SendDirectMessage(moves[itr->second].Packet);
+                continue;
+            }
+
+            // oversized packets go out on their own, keeping their place in the order
+            run.clear();
+            for (; itr != end; ++itr)
+            {
+                if (moves[itr->second].Packet->size() <= MaxCompressedMovePayload)
+                {
+                    run.push_back(itr->second);
+                    continue;
+                }
+
+                sendRun(player, run);
+                run.clear();
+                player->SendDirectMessage(moves[itr->second].Packet);
+            }
+
+            sendRun(player, run);
+        }
+
+        if (bytesSaved)
+        {
+            METRIC_VALUE("map_monster_move_bytes_saved", bytesSaved,
+                METRIC_TAG("map_id", std::to_string(map->GetId())),
+                METRIC_TAG("map_instanceid", std::to_string(map->GetInstanceId())));
+        }
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AC_MONSTER_MOVE_BATCH_H
+#define AC_MONSTER_MOVE_BATCH_H
+
+#include "ObjectGuid.h"
+#include "WorldPacket.h"
+#include <unordered_set>
+#include <vector>
+
+class Map;
+class Unit;
+class WorldObject;
+
+namespace Movement
+{
+    // Collects the monster move packets launched during a map update and sends them once the update
+    // is done. Packets are serialized once per launch; several moves going to the same client are
+    // merged into one SMSG_COMPRESSED_MOVES, shared by every client receiving the same moves.
+    // Packets of a mover that are sent right away (movement, teleport, destroy, out of range) first
+    // send its queued moves through FlushMover, so they never overtake them.
+    class MonsterMoveBatch
+    {
+    public:
+        void Queue(Unit const* mover, WorldPacket&& packet);
+        void Flush(Map* map);
+        void FlushMover(WorldObject const* mover);
+
+        [[nodiscard]] bool IsEmpty() const { return _moves.empty(); }
+
+    private:
+        struct QueuedMove
+        {
+            ObjectGuid Mover;
+            SharedWorldPacket Packet;
+        };
+
+        std::vector<QueuedMove> _moves;
+        std::unordered_set<ObjectGuid> _movers;
+    };
+}
+
+#endif // AC_MONSTER_MOVE_BATCH_H
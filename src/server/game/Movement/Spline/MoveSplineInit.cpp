@@ -24,9 +24,19 @@
 #include "Vehicle.h"
 #include "WorldPacket.h"
 #include "Log.h"
+#include "Map.h"
+#include "World.h"
 
 namespace Movement
 {
+    static void SendMonsterMove(Unit* unit, WorldPacket& data)
+    {
+        if (sWorld->getBoolConfig(CONFIG_MAP_UPDATE_BATCH_MONSTER_MOVES) && unit->IsInWorld())
+            unit->GetMap()->GetMonsterMoveBatch().Queue(unit, std::move(data));
+        else
+            unit->SendMessageToSet(&data, true);
+    }
+
     UnitMoveType SelectSpeedType(uint32 moveFlags)
     {
         if (moveFlags & MOVEMENTFLAG_FLYING)
@@ -145,7 +155,7 @@ namespace Movement
         }
 
         PacketBuilder::WriteMonsterMove(move_spline, data);
-        unit->SendMessageToSet(&data, true);
+        SendMonsterMove(unit, data);
 
         return move_spline.Duration();
     }
@@ -191,7 +201,7 @@ namespace Movement
         }
 
         PacketBuilder::WriteStopMovement(loc, args.splineId, data);
-        unit->SendMessageToSet(&data, true);
+        SendMonsterMove(unit, data);
     }
 
     MoveSplineInit::MoveSplineInit(Unit* m) : unit(m)
@@ -39,6 +39,11 @@ void ScriptMgr::OnBeforeCheckCriteria(AchievementMgr* mgr, std::list<Achievement
     CALL_ENABLED_HOOKS(AchievementScript, ACHIEVEMENTHOOK_ON_BEFORE_CHECK_CRITERIA, script->OnBeforeCheckCriteria(mgr, achievementCriteriaList));
 }
 
+bool ScriptMgr::HasBeforeCheckCriteriaScripts()
+{
+    return !ScriptRegistry<AchievementScript>::EnabledHooks[ACHIEVEMENTHOOK_ON_BEFORE_CHECK_CRITERIA].empty();
+}
+
 bool ScriptMgr::CanCheckCriteria(AchievementMgr* mgr, AchievementCriteriaEntry const* achievementCriteria)
 {
     CALL_ENABLED_BOOLEAN_HOOKS(AchievementScript, ACHIEVEMENTHOOK_CAN_CHECK_CRITERIA, !script->CanCheckCriteria(mgr, achievementCriteria));
@@ -263,6 +263,13 @@ void ScriptMgr::OnMapUpdate(Map* map, uint32 diff)
     });
 }
 
+void ScriptMgr::OnMapObjectsUpdated(Map* map, uint32 diff)
+{
+    ASSERT(map);
+
+    CALL_ENABLED_HOOKS(AllMapScript, ALLMAPHOOK_ON_MAP_OBJECTS_UPDATED, script->OnMapObjectsUpdated(map, diff));
+}
+
 void ScriptMgr::OnBeforeCreateInstanceScript(InstanceMap* instanceMap, InstanceScript** instanceData, bool load, std::string data, uint32 completedEncounterMask)
 {
     CALL_ENABLED_HOOKS(AllMapScript, ALLMAPHOOK_ON_BEFORE_CREATE_INSTANCE_SCRIPT, script->OnBeforeCreateInstanceScript(instanceMap, instanceData, load, data, completedEncounterMask));
@@ -30,6 +30,7 @@ enum AllMapHook
     ALLMAPHOOK_ON_CREATE_MAP,
     ALLMAPHOOK_ON_DESTROY_MAP,
     ALLMAPHOOK_ON_MAP_UPDATE,
+    ALLMAPHOOK_ON_MAP_OBJECTS_UPDATED,
     ALLMAPHOOK_END
 };
 
@@ -95,6 +96,15 @@ public:
      * @param diff Contains information about the diff time
      */
     virtual void OnMapUpdate(Map* /*map*/, uint32 /*diff*/) { }
+
+    /**
+     * @brief This hook called after the players and objects of the map were updated, before their
+     * changes, moves and visibility are sent to the clients in the same map update
+     *
+     * @param map Contains information about the Map
+     * @param diff Contains information about the diff time
+     */
+    virtual void OnMapObjectsUpdated(Map* /*map*/, uint32 /*diff*/) { }
 };
 
 #endif
@@ -214,6 +214,7 @@ public: /* MapScript */
     void OnPlayerEnterMap(Map* map, Player* player);
     void OnPlayerLeaveMap(Map* map, Player* player);
     void OnMapUpdate(Map* map, uint32 diff);
+    void OnMapObjectsUpdated(Map* map, uint32 diff);
 
 public: /* InstanceMapScript */
     InstanceScript* CreateInstanceScript(InstanceMap* map);
@@ -653,6 +654,7 @@ public: /* AchievementScript */
     bool IsCompletedCriteria(AchievementMgr* mgr, AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement, CriteriaProgress const* progress);
     bool IsRealmCompleted(AchievementGlobalMgr const* globalmgr, AchievementEntry const* achievement, std::chrono::system_clock::time_point completionTime);
     void OnBeforeCheckCriteria(AchievementMgr* mgr, AchievementCriteriaEntryList const* achievementCriteriaList);
+    bool HasBeforeCheckCriteriaScripts();
     bool CanCheckCriteria(AchievementMgr* mgr, AchievementCriteriaEntry const* achievementCriteria);
 
 public: /* PetScript */
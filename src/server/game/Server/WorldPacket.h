@@ -21,6 +21,7 @@
 #include "ByteBuffer.h"
 #include "Duration.h"
 #include "Opcodes.h"
+#include <memory>
 
 class WorldPacket : public ByteBuffer
 {
@@ -82,4 +83,36 @@ protected:
     TimePoint m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
 };
 
+/// immutable packet shared by all recipients of a broadcast, sockets queue it without copying
+typedef std::shared_ptr<WorldPacket const> SharedWorldPacket;
+
+/// sends one packet to several players, the first one gets a plain send like SendDirectMessage,
+/// the payload is only copied into a SharedWorldPacket once a second receiver shows up
+class PacketBroadcaster
+{
+public:
+    explicit PacketBroadcaster(WorldPacket const* packet) : _packet(packet) { }
+
+    template<class Receiver>
+    void SendTo(Receiver const* receiver)
+    {
+        if (!_sent)
+        {
+            _sent = true;
+            receiver->SendDirectMessage(_packet);
+            return;
+        }
+
+        if (!_shared)
+            _shared = std::make_shared<WorldPacket const>(*_packet);
+
+        receiver->SendDirectMessage(_shared);
+    }
+
+private:
+    WorldPacket const* _packet;
+    SharedWorldPacket _shared;
+    bool _sent = false;
+};
+
 #endif
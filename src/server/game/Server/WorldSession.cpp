@@ -136,6 +136,7 @@ WorldSession::WorldSession(uint32 id, std::string&& name, uint32 accountFlags, s
     _addonMessageReceiveCount(0),
     _timeSyncClockDeltaQueue(6),
     _timeSyncClockDelta(0),
+    _movementHeartbeatCount(0),
     _pendingTimeSyncRequests(),
     _orderCounter(0),
     _isBot(isBot)
@@ -254,18 +255,18 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
 }
 
 /// Send a packet to the client
-void WorldSession::SendPacket(WorldPacket const* packet)
+bool WorldSession::CanSendPacket(WorldPacket const* packet)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         LOG_ERROR("network.opcode", "{} send NULL_OPCODE", GetPlayerInfo());
-        return;
+        return false;
     }
 
     sScriptMgr->OnPlayerbotPacketSent(GetPlayer(), packet);
 
     if (!m_Socket)
-        return;
+        return false;
 
 #if defined(ACORE_DEBUG)
     // Code for network use statistic
@@ -303,14 +304,25 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     }
 #endif                                                      // !ACORE_DEBUG
 
-    if (!sScriptMgr->CanPacketSend(this, *packet))
-    {
+    return sScriptMgr->CanPacketSend(this, *packet);
+}
+
+void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (!CanSendPacket(packet))
         return;
-    }
 
     m_Socket->SendPacket(*packet);
 }
 
+void WorldSession::SendPacket(SharedWorldPacket const& packet)
+{
+    if (!CanSendPacket(packet.get()))
+        return;
+
+    m_Socket->SendPacket(packet);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -415,10 +415,12 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
     void SynchronizeMovement(MovementInfo& movementInfo);
     void HandleMoverRelocation(MovementInfo& movementInfo, Unit* mover);
+    void SendMovementToObservers(Unit* mover, WorldPacket& data);
     bool VerifyMovementInfo(MovementInfo const& movementInfo, Player* plrMover, Unit* mover, Opcodes opcode) const;
     bool ProcessMovementInfo(MovementInfo& movementInfo, Unit* mover, Player* plrMover, WorldPacket& recvData);
 
     void SendPacket(WorldPacket const* packet);
+    void SendPacket(SharedWorldPacket const& packet);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
 
@@ -1217,6 +1219,9 @@ private:
 
     bool recoveryItem(Item* pItem);
 
+    // common checks of both SendPacket overloads, false if the packet must not reach the socket
+    bool CanSendPacket(WorldPacket const* packet);
+
     // logging helper
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason);
     void LogUnprocessedTail(WorldPacket* packet);
@@ -1277,6 +1282,7 @@ private:
 
     CircularBuffer<std::pair<int64, uint32>> _timeSyncClockDeltaQueue; // first member: clockDelta. Second member: latency of the packet exchange that was used to compute that clockDelta.
     int64 _timeSyncClockDelta;
+    uint32 _movementHeartbeatCount; // heartbeats received, distant observers only get every 2nd, 4th... one
     void ComputeNewClockDelta();
 
     std::map<uint32, uint32> _pendingTimeSyncRequests; // key: counter. value: server time when packet with that counter was sent.
@@ -99,21 +99,22 @@ void EncryptableAndCompressiblePacket::CompressIfNeeded()
     if (!NeedsCompression())
         return;
 
-    uint32 pSize = size();
+    WorldPacket const& payload = GetPacket();
+    uint32 pSize = payload.size();
 
     uint32 destsize = compressBound(pSize);
-    ByteBuffer buf(destsize + sizeof(uint32));
+    WorldPacket buf(SMSG_COMPRESSED_UPDATE_OBJECT, destsize + sizeof(uint32));
     buf.resize(destsize + sizeof(uint32));
 
     buf.put<uint32>(0, pSize);
-    compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32), &destsize, (void*)contents(), pSize);
+    compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32), &destsize, (void*)payload.contents(), pSize);
     if (destsize == 0)
         return;
 
     buf.resize(destsize + sizeof(uint32));
 
-    ByteBuffer::operator=(std::move(buf));
-    SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
+    _packet = std::move(buf);
+    _shared.reset();
 }
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
@@ -172,11 +173,12 @@ bool WorldSocket::Update()
         do
         {
             queued->CompressIfNeeded();
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+            WorldPacket const& packet = queued->GetPacket();
+            ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
+            currentPacketSize = packet.size() + header.getHeaderLength();
 
             if (buffer.GetRemainingSpace() < currentPacketSize)
             {
@@ -187,8 +189,8 @@ bool WorldSocket::Update()
             if (buffer.GetRemainingSpace() >= currentPacketSize)
             {
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!packet.empty())
+                    buffer.Write(packet.contents(), packet.size());
             }
             else    // Single packet larger than current buffer size
             {
@@ -200,8 +202,8 @@ bool WorldSocket::Update()
                     _sendBufferSize = currentPacketSize;
 
                 buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                if (!packet.empty())
+                    buffer.Write(packet.contents(), packet.size());
             }
 
             delete queued;
@@ -526,6 +528,17 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
 }
 
+void WorldSocket::SendPacket(SharedWorldPacket const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket() && IsLoggingPackets())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
+}
+
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
 {
     std::shared_ptr<AuthSession> authSession = std::make_shared<AuthSession>();
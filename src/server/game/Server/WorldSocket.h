@@ -29,23 +29,35 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptableAndCompressiblePacket : public WorldPacket
+void compressBuff(void* dst, uint32* dst_size, void* src, int src_size);
+
+class EncryptableAndCompressiblePacket
 {
 public:
-    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : _packet(packet), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // payload is shared with the other recipients, only the header is built per socket
+    EncryptableAndCompressiblePacket(SharedWorldPacket packet, bool encrypt) : _shared(std::move(packet)), _encrypt(encrypt)
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
     bool NeedsEncryption() const { return _encrypt; }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    bool NeedsCompression() const { return GetPacket().GetOpcode() == SMSG_UPDATE_OBJECT && GetPacket().size() > 100; }
 
     void CompressIfNeeded();
 
+    WorldPacket const& GetPacket() const { return _shared ? *_shared : _packet; }
+
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
+    WorldPacket _packet;        // own copy of a single send, also receives the compressed packet
+    SharedWorldPacket _shared;  // never modified, compression writes into _packet and drops the reference
     bool _encrypt;
 };
 
@@ -82,6 +94,7 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(SharedWorldPacket const& packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
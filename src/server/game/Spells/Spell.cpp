@@ -9051,30 +9051,48 @@ namespace Acore
     }
 
     bool WorldObjectSpellAreaTargetCheck::operator()(WorldObject* target)
+    {
+        if (!IsInArea(target))
+            return false;
+        return WorldObjectSpellTargetCheck::operator ()(target);
+    }
+
+    // position and type checks only, cheap enough to run on every object of the visited cells
+    bool WorldObjectSpellAreaTargetCheck::IsInArea(WorldObject const* target) const
     {
         if (target->IsGameObject())
-        {
-            if (!target->ToGameObject()->IsInRange(_position->GetPositionX(), _position->GetPositionY(), _position->GetPositionZ(), _range))
-                return false;
-        }
-        else if (!target->IsWithinDist3d(_position, _range))
+            return target->ToGameObject()->IsInRange(_position->GetPositionX(), _position->GetPositionY(), _position->GetPositionZ(), _range);
+
+        if (!target->IsWithinDist3d(_position, _range))
             return false;
-        else if (target->IsCreature() && target->ToCreature()->IsAvoidingAOE()) // pussywizard
+
+        if (target->IsCreature() && target->ToCreature()->IsAvoidingAOE()) // pussywizard
             return false;
-        return WorldObjectSpellTargetCheck::operator ()(target);
+
+        return true;
     }
 
     WorldObjectSpellConeTargetCheck::WorldObjectSpellConeTargetCheck(float coneAngle, float range, Unit* caster,
             SpellInfo const* spellInfo, SpellTargetCheckTypes selectionType, ConditionList* condList)
-        : WorldObjectSpellAreaTargetCheck(range, caster, caster, caster, spellInfo, selectionType, condList), _coneAngle(coneAngle)
+        : WorldObjectSpellAreaTargetCheck(range, caster, caster, caster, spellInfo, selectionType, condList), _coneAngle(coneAngle),
+        _coneBack(spellInfo->HasAttribute(SPELL_ATTR0_CU_CONE_BACK))
     {
+        // same arc as Position::HasInArc, isInBack tests the complementary front arc
+        float arc = Position::NormalizeOrientation(_coneBack ? 2 * M_PI - coneAngle : coneAngle);
+        _coneArcCos = std::cos(arc / 2.0f);
+        _coneDirX = std::cos(caster->GetOrientation());
+        _coneDirY = std::sin(caster->GetOrientation());
     }
 
     bool WorldObjectSpellConeTargetCheck::operator()(WorldObject* target)
     {
-        if (_spellInfo->HasAttribute(SPELL_ATTR0_CU_CONE_BACK))
+        // range first, the cone shape only for objects inside it and the spell checks last
+        if (!IsInArea(target))
+            return false;
+
+        if (_coneBack)
         {
-            if (!_caster->isInBack(target, _coneAngle))
+            if (IsInCone(target))
                 return false;
         }
         else if (_spellInfo->HasAttribute(SPELL_ATTR0_CU_CONE_LINE))
@@ -9084,10 +9102,24 @@ namespace Acore
         }
         else
         {
-            if (!_caster->IsWithinBoundaryRadius(target->ToUnit()) && !_caster->isInFront(target, _coneAngle))
+            if (!_caster->IsWithinBoundaryRadius(target->ToUnit()) && !IsInCone(target))
                 return false;
         }
-        return WorldObjectSpellAreaTargetCheck::operator ()(target);
+
+        return WorldObjectSpellTargetCheck::operator ()(target);
+    }
+
+    // Position::HasInArc with the precomputed arc: the angle to the target is within half the arc
+    // of the caster facing when the cosine between the facing and the target direction is large enough
+    bool WorldObjectSpellConeTargetCheck::IsInCone(WorldObject const* target) const
+    {
+        float dx = target->GetPositionX() - _caster->GetPositionX();
+        float dy = target->GetPositionY() - _caster->GetPositionY();
+        float distSq = dx * dx + dy * dy;
+        if (distSq < 0.0001f)
+            return _caster->HasInArc(_coneBack ? 2 * M_PI - _coneAngle : _coneAngle, target);
+
+        return (dx * _coneDirX + dy * _coneDirY) >= _coneArcCos * std::sqrt(distSq);
     }
 
     WorldObjectSpellTrajTargetCheck::WorldObjectSpellTrajTargetCheck(float range, Position const* position, Unit* caster,
@@ -9098,11 +9130,11 @@ namespace Acore
 
     bool WorldObjectSpellTrajTargetCheck::operator()(WorldObject* target)
     {
-        // return all targets on missile trajectory (0 - size of a missile)
-        if (!_caster->HasInLine(target, target->GetCombatReach(), TRAJECTORY_MISSILE_SIZE))
+        if (target->GetExactDist2dSq(_position) > _range * _range)
             return false;
 
-        if (target->GetExactDist2d(_position) > _range)
+        // return all targets on missile trajectory (0 - size of a missile)
+        if (!_caster->HasInLine(target, target->GetCombatReach(), TRAJECTORY_MISSILE_SIZE))
             return false;
 
         return WorldObjectSpellTargetCheck::operator ()(target);
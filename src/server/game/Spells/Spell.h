@@ -829,14 +829,21 @@ namespace Acore
         WorldObjectSpellAreaTargetCheck(float range, Position const* position, Unit* caster,
                                         Unit* referer, SpellInfo const* spellInfo, SpellTargetCheckTypes selectionType, ConditionList* condList);
         bool operator()(WorldObject* target);
+        [[nodiscard]] bool IsInArea(WorldObject const* target) const;
     };
 
     struct WorldObjectSpellConeTargetCheck : public WorldObjectSpellAreaTargetCheck
     {
         float _coneAngle;
+        // cone shape precomputed from the caster facing: cosine of the half arc and facing direction
+        float _coneArcCos;
+        float _coneDirX;
+        float _coneDirY;
+        bool _coneBack;
         WorldObjectSpellConeTargetCheck(float coneAngle, float range, Unit* caster,
                                         SpellInfo const* spellInfo, SpellTargetCheckTypes selectionType, ConditionList* condList);
         bool operator()(WorldObject* target);
+        [[nodiscard]] bool IsInCone(WorldObject const* target) const;
     };
 
     struct WorldObjectSpellTrajTargetCheck : public WorldObjectSpellAreaTargetCheck
@@ -694,7 +694,7 @@ void SpellMgr::GetSetOfSpellsInSpellGroup(SpellGroup group_id, std::set<uint32>&
     }
 }
 
-bool SpellMgr::AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uint32 auraType, int32 amount, std::map<SpellGroup, int32>& groups) const
+bool SpellMgr::AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uint32 auraType, int32 amount, SameEffectSpellGroupAmounts& groups) const
 {
     uint32 spellId = spellInfo->GetFirstRankSpell()->Id;
     auto spellGroupBounds = GetSpellSpellGroupMapBounds(spellId);
@@ -709,15 +709,14 @@ bool SpellMgr::AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uin
             if (!found->second.count(auraType))
                 continue;
 
-            // Put the highest amount in the map
-            auto groupItr = groups.find(group);
+            // Put the highest amount in the list
+            auto groupItr = std::find_if(groups.begin(), groups.end(), [group](std::pair<SpellGroup, int32> const& groupAmount) { return groupAmount.first == group; });
             if (groupItr == groups.end())
-                groups.emplace(group, amount);
+                groups.emplace_back(group, amount);
             else
             {
-                int32 curr_amount = groups[group];
                 // Take absolute value because this also counts for the highest negative aura
-                if (std::abs(curr_amount) < std::abs(amount))
+                if (std::abs(groupItr->second) < std::abs(amount))
                     groupItr->second = amount;
             }
             // return because a spell should be in only one SPELL_GROUP_STACK_RULE_EXCLUSIVE_SAME_EFFECT group per auraType
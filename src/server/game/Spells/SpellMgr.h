@@ -24,6 +24,7 @@
 #include "IteratorPair.h"
 #include "SharedDefines.h"
 #include "Unit.h"
+#include <boost/container/small_vector.hpp>
 
 class SpellInfo;
 class Player;
@@ -374,6 +375,9 @@ typedef std::unordered_map<SpellGroup, SpellGroupStackRule> SpellGroupStackMap;
 
 typedef std::unordered_map<SpellGroup, std::unordered_set<uint32 /*auraName*/>> SameEffectStackMap;
 
+// highest amount per SPELL_GROUP_STACK_RULE_EXCLUSIVE_SAME_EFFECT group, few groups apply to one aura type at once
+typedef boost::container::small_vector<std::pair<SpellGroup, int32>, 8> SameEffectSpellGroupAmounts;
+
 struct SpellThreatEntry
 {
     int32       flatMod;                                    // flat threat-value for this Spell  - default: 0
@@ -681,7 +685,7 @@ public:
     void GetSetOfSpellsInSpellGroup(SpellGroup group_id, std::set<uint32>& foundSpells, std::set<SpellGroup>& usedGroups) const;
 
     // Spell Group Stack Rules table
-    bool AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uint32 auraType, int32 amount, std::map<SpellGroup, int32>& groups) const;
+    bool AddSameEffectStackRuleSpellGroups(SpellInfo const* spellInfo, uint32 auraType, int32 amount, SameEffectSpellGroupAmounts& groups) const;
     SpellGroupStackRule CheckSpellGroupStackRules(SpellInfo const* spellInfo1, SpellInfo const* spellInfo2) const;
     SpellGroupStackRule GetSpellGroupStackRule(SpellGroup group_id) const;
 
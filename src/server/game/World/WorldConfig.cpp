@@ -543,6 +543,14 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_SHOW_MUTE_IN_WORLD, "ShowMuteInWorld", false);
     SetConfigValue<bool>(CONFIG_SHOW_BAN_IN_WORLD, "ShowBanInWorld", false);
     SetConfigValue<uint32>(CONFIG_NUMTHREADS, "MapUpdate.Threads", 1);
+    SetConfigValue<bool>(CONFIG_MAP_UPDATE_LOD_ENABLE, "MapUpdate.LOD.Enable", false);
+    SetConfigValue<float>(CONFIG_MAP_UPDATE_LOD_DISTANCE, "MapUpdate.LOD.Distance", 100.0f, ConfigValueCache::Reloadable::Yes, [](float const& value) { return value > 0.0f; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_MAP_UPDATE_LOD_MAX_LEVEL, "MapUpdate.LOD.MaxLevel", 3, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value <= MAX_UPDATE_LOD_LEVEL; }, "<= 4");
+    SetConfigValue<bool>(CONFIG_MAP_UPDATE_BATCH_MONSTER_MOVES, "MapUpdate.BatchMonsterMoves", false);
+    SetConfigValue<bool>(CONFIG_MAP_UPDATE_COALESCE_MOVEMENT, "MapUpdate.CoalesceMovement", false);
+    SetConfigValue<float>(CONFIG_MAP_UPDATE_COALESCE_MOVEMENT_DISTANCE, "MapUpdate.CoalesceMovement.Distance", 40.0f, ConfigValueCache::Reloadable::Yes, [](float const& value) { return value > 0.0f; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_MAP_UPDATE_COALESCE_MOVEMENT_MAX_LEVEL, "MapUpdate.CoalesceMovement.MaxLevel", 2, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value <= 4; }, "<= 4");
+    SetConfigValue<bool>(CONFIG_MAP_LOS_CACHE, "MapUpdate.LineOfSightCache", true);
     SetConfigValue<uint32>(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS, "Command.LookupMaxResults", 0);
 
     // Warden
@@ -297,6 +297,14 @@ enum ServerConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAP_UPDATE_LOD_ENABLE,
+    CONFIG_MAP_UPDATE_LOD_DISTANCE,
+    CONFIG_MAP_UPDATE_LOD_MAX_LEVEL,
+    CONFIG_MAP_UPDATE_BATCH_MONSTER_MOVES,
+    CONFIG_MAP_UPDATE_COALESCE_MOVEMENT,
+    CONFIG_MAP_UPDATE_COALESCE_MOVEMENT_DISTANCE,
+    CONFIG_MAP_UPDATE_COALESCE_MOVEMENT_MAX_LEVEL,
+    CONFIG_MAP_LOS_CACHE,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_TELEPORT_TIMEOUT_NEAR,
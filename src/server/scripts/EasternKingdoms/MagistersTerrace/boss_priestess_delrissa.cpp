@@ -233,7 +233,7 @@ struct boss_priestess_lackey_commonAI : public ScriptedAI
 
     void RecalculateThreat()
     {
-        ThreatContainer::StorageType const& tList = me->GetThreatMgr().GetThreatList();
+        ThreatContainer::StorageType const tList = me->GetThreatMgr().GetThreatList(); // copy, adding threat may add a charmer to the list
         for (auto const& ref : tList)
         {
             Unit* pUnit = ObjectAccessor::GetUnit(*me, ref->getUnitGuid());
@@ -117,8 +117,10 @@ public:
                         std::list<Unit*> meleeRangeTargets;
                         Unit* finalTarget = nullptr;
                         uint8 counter = 0;
-                        auto i = me->GetThreatMgr().GetThreatList().begin();
-                        for (; i != me->GetThreatMgr().GetThreatList().end(); ++i, ++counter)
+                        // copy, adding threat may add the owner of a pet to the list
+                        ThreatContainer::StorageType const threatList = me->GetThreatMgr().GetThreatList();
+                        auto i = threatList.begin();
+                        for (; i != threatList.end(); ++i, ++counter)
                         {
                             // Gather all units with melee range
                             Unit* target = (*i)->getTarget();
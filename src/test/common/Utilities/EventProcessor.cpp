@@ -0,0 +1,146 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventProcessor.h"
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+    class RecordEvent : public BasicEvent
+    {
+    public:
+        RecordEvent(std::vector<uint32>& log, uint32 id) : _log(log), _id(id) { }
+
+        bool Execute(uint64, uint32) override
+        {
+            _log.push_back(_id);
+            return true;
+        }
+
+    private:
+        std::vector<uint32>& _log;
+        uint32 _id;
+    };
+}
+
+TEST(EventProcessorTest, RunsEventsInTimeThenInsertionOrder)
+{
+    EventProcessor events;
+    std::vector<uint32> log;
+
+    events.AddEventAtOffset(new RecordEvent(log, 1), 300ms);
+    events.AddEventAtOffset(new RecordEvent(log, 2), 100ms);
+    events.AddEventAtOffset(new RecordEvent(log, 3), 300ms);
+    events.AddEventAtOffset(new RecordEvent(log, 4), 0ms);
+
+    events.Update(99);
+    EXPECT_EQ(log, std::vector<uint32>({ 4 }));
+
+    events.Update(1000);
+    EXPECT_EQ(log, std::vector<uint32>({ 4, 2, 1, 3 }));
+    EXPECT_FALSE(events.HasEvents());
+}
+
+TEST(EventProcessorTest, KeepsOrderAcrossWheelLevels)
+{
+    EventProcessor events;
+    std::vector<uint32> log;
+
+    // scheduled early, cascades down the wheel before the second one is added
+    events.AddEventAtOffset(new RecordEvent(log, 1), 100000ms);
+    events.Update(99990);
+    events.AddEventAtOffset(new RecordEvent(log, 2), 10ms);
+    events.AddEventAtOffset(new RecordEvent(log, 3), 5ms);
+
+    // beyond the wheel span
+    events.AddEventAtOffset(new RecordEvent(log, 4), 48h);
+
+    for (uint32 i = 0; i < 20; ++i)
+        events.Update(1);
+
+    EXPECT_EQ(log, std::vector<uint32>({ 3, 1, 2 }));
+
+    events.Update(172800000 - 30);
+    EXPECT_EQ(log.size(), 3u);
+    events.Update(20);
+    EXPECT_EQ(log, std::vector<uint32>({ 3, 1, 2, 4 }));
+}
+
+TEST(EventProcessorTest, ModifyAndCancel)
+{
+    EventProcessor events;
+    std::vector<uint32> log;
+
+    BasicEvent* moved = new RecordEvent(log, 1);
+    events.AddEventAtOffset(moved, 5s);
+    events.AddEventAtOffset(new RecordEvent(log, 2), 1s, 1);
+    events.AddEventAtOffset(new RecordEvent(log, 3), 2s);
+
+    events.ModifyEventTime(moved, Milliseconds(events.CalculateTime(500)));
+    events.CancelEventGroup(1);
+
+    events.Update(10000);
+    EXPECT_EQ(log, std::vector<uint32>({ 1, 3 }));
+}
+
+TEST(EventProcessorTest, SchedulesAgainAfterRunningEmpty)
+{
+    EventProcessor events;
+    std::vector<uint32> log;
+
+    events.AddEventAtOffset(new RecordEvent(log, 1), 70s);
+    events.Update(70000);
+    EXPECT_FALSE(events.HasEvents());
+
+    // the wheel is released once empty, later events start a new one at the current time
+    events.Update(5);
+    events.AddEventAtOffset(new RecordEvent(log, 2), 100s);
+    events.AddEventAtOffset(new RecordEvent(log, 3), 10ms);
+    EXPECT_TRUE(events.HasEvents());
+
+    events.Update(10);
+    EXPECT_EQ(log, std::vector<uint32>({ 1, 3 }));
+    events.Update(100000);
+    EXPECT_EQ(log, std::vector<uint32>({ 1, 3, 2 }));
+    EXPECT_FALSE(events.HasEvents());
+}
+
+TEST(EventProcessorTest, TimeToNextEvent)
+{
+    EventProcessor events;
+    std::vector<uint32> log;
+
+    EXPECT_EQ(events.GetTimeToNextEvent(), std::numeric_limits<uint64>::max());
+
+    events.AddEventAtOffset(new RecordEvent(log, 1), 40ms);
+    EXPECT_EQ(events.GetTimeToNextEvent(), 40u);
+
+    // a bound from the coarser wheel levels, never later than the event
+    events.Update(40);
+    events.AddEventAtOffset(new RecordEvent(log, 2), 90s);
+    EXPECT_GT(events.GetTimeToNextEvent(), 0u);
+    EXPECT_LE(events.GetTimeToNextEvent(), 90000u);
+
+    events.Update(89999);
+    EXPECT_EQ(events.GetTimeToNextEvent(), 1u);
+    events.Update(1);
+    EXPECT_EQ(log, std::vector<uint32>({ 1, 2 }));
+    EXPECT_EQ(events.GetTimeToNextEvent(), std::numeric_limits<uint64>::max());
+}